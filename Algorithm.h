@@ -0,0 +1,483 @@
+#ifndef ALGORITHM_H
+#define ALGORITHM_H
+
+
+#include "Vector.h"
+
+// Taille à partir de laquelle sort() sans comparateur utilise un tri par base ( radix ) sur les
+// types entiers. Le tri par base demande un buffer temporaire de la taille des données : il est
+// désactivé par défaut sur AVR où la RAM manque.
+#ifndef ARD_C_RADIX_SORT_MIN
+	#if defined(__AVR__)
+		#define ARD_C_RADIX_SORT_MIN 0x7FFF
+	#else
+		#define ARD_C_RADIX_SORT_MIN 256
+	#endif
+#endif
+
+namespace ard_c
+{
+	// Tri et recherche sur des plages [first, last) et sur les Vector.
+	// Les comparateurs sont des foncteurs renvoyant vrai si le premier argument doit être
+	// placé avant le second ( Less<T> par défaut ).
+
+	template<typename T>
+	struct Less
+	{
+		bool operator()(const T &a, const T &b) const { return a < b; }
+	};
+	template<typename T>
+	struct Greater
+	{
+		bool operator()(const T &a, const T &b) const { return b < a; }
+	};
+
+
+	inline int floor_log2(int n)
+	{
+		int l = 0;
+		while (n > 1) { n >>= 1; ++l; }
+		return l;
+	}
+
+	template<typename T, typename C>
+	inline void insertion_sort(T *first, T *last, C cmp)
+	{
+		if (last - first < 2) return;
+		for (T *i = first + 1; i < last; ++i)
+		{
+			if (!cmp(*i, *(i - 1))) continue;
+			T v(ard_c::move(*i));
+			T *j = i;
+			do
+			{
+				*j = ard_c::move(*(j - 1));
+				--j;
+			} while (j > first && cmp(v, *(j - 1)));
+			*j = ard_c::move(v);
+		}
+	}
+
+
+	// Tas binaire dont la racine est le plus grand élément au sens de 'cmp'.
+	template<typename T, typename C>
+	inline void sift_down(T *heap, int i, int n, C cmp)
+	{
+		T v(ard_c::move(heap[i]));
+		for (;;)
+		{
+			int c = 2 * i + 1;
+			if (c >= n) break;
+			if (c + 1 < n && cmp(heap[c], heap[c + 1])) ++c;
+			if (!cmp(v, heap[c])) break;
+			heap[i] = ard_c::move(heap[c]);
+			i = c;
+		}
+		heap[i] = ard_c::move(v);
+	}
+	template<typename T, typename C>
+	inline void make_heap(T *heap, int n, C cmp)
+	{
+		for (int i = n / 2 - 1; i >= 0; --i) sift_down(heap, i, n, cmp);
+	}
+	template<typename T, typename C>
+	inline void sort_heap(T *heap, int n, C cmp)
+	{
+		for (int end = n - 1; end > 0; --end)
+		{
+			ard_c::swap(heap[0], heap[end]);
+			sift_down(heap, 0, end, cmp);
+		}
+	}
+
+
+	// Place la médiane de *a, *b, *c dans *result.
+	template<typename T, typename C>
+	inline void move_median_to_first(T *result, T *a, T *b, T *c, C cmp)
+	{
+		if (cmp(*a, *b))
+		{
+			if (cmp(*b, *c)) ard_c::swap(*result, *b);
+			else if (cmp(*a, *c)) ard_c::swap(*result, *c);
+			else ard_c::swap(*result, *a);
+		}
+		else if (cmp(*a, *c)) ard_c::swap(*result, *a);
+		else if (cmp(*b, *c)) ard_c::swap(*result, *c);
+		else ard_c::swap(*result, *b);
+	}
+
+	// Partitionne [first, last) autour de la médiane de trois éléments, placée en *first.
+	// Renvoie 'cut' tel que [first, cut) <= pivot <= [cut, last). Les boucles internes n'ont
+	// pas besoin de tester les bornes : la médiane garantit un élément d'arrêt de chaque côté.
+	template<typename T, typename C>
+	inline T *partition_pivot(T *first, T *last, C cmp)
+	{
+		move_median_to_first(first, first + 1, first + (last - first) / 2, last - 1, cmp);
+		T *lo = first + 1;
+		T *hi = last;
+		for (;;)
+		{
+			while (cmp(*lo, *first)) ++lo;
+			--hi;
+			while (cmp(*first, *hi)) --hi;
+			if (!(lo < hi)) return lo;
+			ard_c::swap(*lo, *hi);
+			++lo;
+		}
+	}
+
+	// Introsort : quicksort, heapsort quand la profondeur dépasse 2.log2(n), insertion en dessous de 16 éléments.
+	// La récursion se fait sur la plus petite partition pour borner la pile.
+	template<typename T, typename C>
+	inline void intro_sort(T *first, T *last, int depth, C cmp)
+	{
+		while (last - first > 16)
+		{
+			if (depth == 0)
+			{
+				make_heap(first, (int)(last - first), cmp);
+				sort_heap(first, (int)(last - first), cmp);
+				return;
+			}
+			--depth;
+			T *cut = partition_pivot(first, last, cmp);
+			if (cut - first < last - cut)
+			{
+				intro_sort(first, cut, depth, cmp);
+				first = cut;
+			}
+			else
+			{
+				intro_sort(cut, last, depth, cmp);
+				last = cut;
+			}
+		}
+		insertion_sort(first, last, cmp);
+	}
+
+
+	// Tri par base LSD sur 8 bits, un passage par octet, en sautant les octets identiques
+	// pour tous les éléments. Renvoie false si le buffer temporaire n'a pas pu être alloué.
+	template<typename T>
+	inline bool radix_sort(T *first, T *last)
+	{
+		const int n = (int)(last - first);
+		T *buffer = reinterpret_cast<T*>(::malloc(sizeof(T) * n));
+		if (!buffer) return false;
+
+		const bool isSigned = (T)-1 < (T)1;
+		T *src = first;
+		T *dst = buffer;
+		int count[256];
+		for (unsigned pass = 0; pass < sizeof(T); ++pass)
+		{
+			const unsigned shift = pass * 8;
+			const unsigned flip = (isSigned && pass == sizeof(T) - 1) ? 0x80 : 0;
+			::memset(count, 0, sizeof(count));
+			for (int i = 0; i < n; ++i) ++count[(((unsigned long long)src[i] >> shift) & 0xFF) ^ flip];
+			if (count[(((unsigned long long)src[0] >> shift) & 0xFF) ^ flip] == n) continue;
+
+			int sum = 0;
+			for (int b = 0; b < 256; ++b)
+			{
+				int c = count[b];
+				count[b] = sum;
+				sum += c;
+			}
+			for (int i = 0; i < n; ++i) dst[count[(((unsigned long long)src[i] >> shift) & 0xFF) ^ flip]++] = src[i];
+			T *t = src;
+			src = dst;
+			dst = t;
+		}
+		if (src != first) ::memcpy(first, src, sizeof(T) * n);
+		::free(buffer);
+		return true;
+	}
+
+	template<typename T>
+	inline void sort(T *first, T *last, true_type)
+	{
+		if (last - first >= ARD_C_RADIX_SORT_MIN && radix_sort(first, last)) return;
+		intro_sort(first, last, 2 * floor_log2((int)(last - first)), Less<T>());
+	}
+	template<typename T>
+	inline void sort(T *first, T *last, false_type)
+	{
+		intro_sort(first, last, 2 * floor_log2((int)(last - first)), Less<T>());
+	}
+
+
+	// sort
+	// Tri en place, non stable. Sans comparateur, les types entiers de plus de
+	// ARD_C_RADIX_SORT_MIN éléments sont triés par base.
+	template<typename T>
+	inline void sort(T *first, T *last)
+	{
+		if (last - first < 2) return;
+		sort(first, last, integral_constant<bool, is_integral<T>::value>());
+	}
+	template<typename T, typename C>
+	inline void sort(T *first, T *last, C cmp)
+	{
+		if (last - first < 2) return;
+		intro_sort(first, last, 2 * floor_log2((int)(last - first)), cmp);
+	}
+
+
+	// 'buffer' est de la mémoire brute pouvant contenir la moitié de la plage.
+	template<typename T, typename C>
+	inline void merge_sort(T *first, T *last, T *buffer, C cmp)
+	{
+		const int n = (int)(last - first);
+		if (n <= 16)
+		{
+			insertion_sort(first, last, cmp);
+			return;
+		}
+		T *mid = first + n / 2;
+		merge_sort(first, mid, buffer, cmp);
+		merge_sort(mid, last, buffer, cmp);
+		if (!cmp(*mid, *(mid - 1))) return;
+
+		const int left = (int)(mid - first);
+		for (int i = 0; i < left; ++i) new (buffer + i) T(ard_c::move(first[i]));
+		T *a = buffer;
+		T *aEnd = buffer + left;
+		T *b = mid;
+		T *out = first;
+		while (a < aEnd && b < last)
+		{
+			if (cmp(*b, *a)) *out++ = ard_c::move(*b++);
+			else *out++ = ard_c::move(*a++);
+		}
+		while (a < aEnd) *out++ = ard_c::move(*a++);
+		destroy_n(buffer, left);
+	}
+
+	// stableSort
+	// Tri en place conservant l'ordre des éléments égaux ( tri fusion ). Utilise un buffer
+	// temporaire de la moitié de la plage, ou un tri par insertion s'il ne peut pas être alloué.
+	template<typename T, typename C>
+	inline void stableSort(T *first, T *last, C cmp)
+	{
+		const int n = (int)(last - first);
+		if (n < 2) return;
+		T *buffer = reinterpret_cast<T*>(::malloc(sizeof(T) * (n / 2)));
+		if (!buffer)
+		{
+			insertion_sort(first, last, cmp);
+			return;
+		}
+		merge_sort(first, last, buffer, cmp);
+		::free(buffer);
+	}
+	template<typename T>
+	inline void stableSort(T *first, T *last)
+	{
+		stableSort(first, last, Less<T>());
+	}
+
+
+	// partialSort
+	// Place dans [first, middle), triés, les plus petits éléments de [first, last).
+	// L'ordre de [middle, last) est indéfini.
+	template<typename T, typename C>
+	inline void partialSort(T *first, T *middle, T *last, C cmp)
+	{
+		const int k = (int)(middle - first);
+		if (k <= 0) return;
+		make_heap(first, k, cmp);
+		for (T *i = middle; i < last; ++i)
+		{
+			if (cmp(*i, *first))
+			{
+				ard_c::swap(*i, *first);
+				sift_down(first, 0, k, cmp);
+			}
+		}
+		sort_heap(first, k, cmp);
+	}
+	template<typename T>
+	inline void partialSort(T *first, T *middle, T *last)
+	{
+		partialSort(first, middle, last, Less<T>());
+	}
+
+
+	// nthElement
+	// Place en *nth l'élément qui s'y trouverait si la plage était triée, les éléments avant
+	// lui ne sont pas plus grands et ceux après pas plus petits. Sert au calcul de médiane.
+	template<typename T, typename C>
+	inline void nthElement(T *first, T *nth, T *last, C cmp)
+	{
+		if (nth >= last) return;
+		int depth = 2 * floor_log2((int)(last - first));
+		while (last - first > 16)
+		{
+			if (depth-- == 0)
+			{
+				partialSort(first, nth + 1, last, cmp);
+				return;
+			}
+			T *cut = partition_pivot(first, last, cmp);
+			if (cut <= nth) first = cut;
+			else last = cut;
+		}
+		insertion_sort(first, last, cmp);
+	}
+	template<typename T>
+	inline void nthElement(T *first, T *nth, T *last)
+	{
+		nthElement(first, nth, last, Less<T>());
+	}
+
+
+	// lowerBound / upperBound
+	// Sur une plage triée selon 'cmp', renvoie le premier élément qui n'est pas avant 'value'
+	// ( lowerBound ) ou qui est après 'value' ( upperBound ). Écrit sans branchement pour que
+	// le compilateur génère des cmov sur host.
+	template<typename T, typename C>
+	inline const T *lowerBound(const T *first, const T *last, const T &value, C cmp)
+	{
+		int n = (int)(last - first);
+		while (n > 0)
+		{
+			int half = n / 2;
+			bool after = cmp(first[half], value);
+			first = after ? first + half + 1 : first;
+			n = after ? n - half - 1 : half;
+		}
+		return first;
+	}
+	template<typename T>
+	inline const T *lowerBound(const T *first, const T *last, const T &value)
+	{
+		return lowerBound(first, last, value, Less<T>());
+	}
+	template<typename T, typename C>
+	inline const T *upperBound(const T *first, const T *last, const T &value, C cmp)
+	{
+		int n = (int)(last - first);
+		while (n > 0)
+		{
+			int half = n / 2;
+			bool after = !cmp(value, first[half]);
+			first = after ? first + half + 1 : first;
+			n = after ? n - half - 1 : half;
+		}
+		return first;
+	}
+	template<typename T>
+	inline const T *upperBound(const T *first, const T *last, const T &value)
+	{
+		return upperBound(first, last, value, Less<T>());
+	}
+
+	// binarySearch
+	// Sur une plage triée selon 'cmp', renvoie un élément égal à 'value' ou 0.
+	template<typename T, typename C>
+	inline const T *binarySearch(const T *first, const T *last, const T &value, C cmp)
+	{
+		const T *p = lowerBound(first, last, value, cmp);
+		return (p != last && !cmp(value, *p)) ? p : 0;
+	}
+	template<typename T>
+	inline const T *binarySearch(const T *first, const T *last, const T &value)
+	{
+		return binarySearch(first, last, value, Less<T>());
+	}
+
+
+	// Versions Vector. Les tris provoquent un detach(), les recherches renvoient un index
+	// ( -1 si binarySearch ne trouve pas la valeur ) et ne détachent pas.
+
+	template<typename T, typename R, typename A>
+	inline void sort(Vector<T, R, A> &v)
+	{
+		T *d = v.data();
+		sort(d, d + v.size());
+	}
+	template<typename T, typename R, typename A, typename C>
+	inline void sort(Vector<T, R, A> &v, C cmp)
+	{
+		T *d = v.data();
+		sort(d, d + v.size(), cmp);
+	}
+	template<typename T, typename R, typename A>
+	inline void stableSort(Vector<T, R, A> &v)
+	{
+		T *d = v.data();
+		stableSort(d, d + v.size());
+	}
+	template<typename T, typename R, typename A, typename C>
+	inline void stableSort(Vector<T, R, A> &v, C cmp)
+	{
+		T *d = v.data();
+		stableSort(d, d + v.size(), cmp);
+	}
+	template<typename T, typename R, typename A>
+	inline void partialSort(Vector<T, R, A> &v, int middle)
+	{
+		T *d = v.data();
+		partialSort(d, d + middle, d + v.size());
+	}
+	template<typename T, typename R, typename A, typename C>
+	inline void partialSort(Vector<T, R, A> &v, int middle, C cmp)
+	{
+		T *d = v.data();
+		partialSort(d, d + middle, d + v.size(), cmp);
+	}
+	template<typename T, typename R, typename A>
+	inline void nthElement(Vector<T, R, A> &v, int nth)
+	{
+		T *d = v.data();
+		nthElement(d, d + nth, d + v.size());
+	}
+	template<typename T, typename R, typename A, typename C>
+	inline void nthElement(Vector<T, R, A> &v, int nth, C cmp)
+	{
+		T *d = v.data();
+		nthElement(d, d + nth, d + v.size(), cmp);
+	}
+
+	template<typename T, typename R, typename A>
+	inline int lowerBound(const Vector<T, R, A> &v, const T &value)
+	{
+		const T *d = v.constData();
+		return (int)(lowerBound(d, d + v.size(), value) - d);
+	}
+	template<typename T, typename R, typename A, typename C>
+	inline int lowerBound(const Vector<T, R, A> &v, const T &value, C cmp)
+	{
+		const T *d = v.constData();
+		return (int)(lowerBound(d, d + v.size(), value, cmp) - d);
+	}
+	template<typename T, typename R, typename A>
+	inline int upperBound(const Vector<T, R, A> &v, const T &value)
+	{
+		const T *d = v.constData();
+		return (int)(upperBound(d, d + v.size(), value) - d);
+	}
+	template<typename T, typename R, typename A, typename C>
+	inline int upperBound(const Vector<T, R, A> &v, const T &value, C cmp)
+	{
+		const T *d = v.constData();
+		return (int)(upperBound(d, d + v.size(), value, cmp) - d);
+	}
+	template<typename T, typename R, typename A>
+	inline int binarySearch(const Vector<T, R, A> &v, const T &value)
+	{
+		const T *d = v.constData();
+		const T *p = binarySearch(d, d + v.size(), value);
+		return p ? (int)(p - d) : -1;
+	}
+	template<typename T, typename R, typename A, typename C>
+	inline int binarySearch(const Vector<T, R, A> &v, const T &value, C cmp)
+	{
+		const T *d = v.constData();
+		const T *p = binarySearch(d, d + v.size(), value, cmp);
+		return p ? (int)(p - d) : -1;
+	}
+}
+
+#endif // !ALGORITHM_H
@@ -0,0 +1,264 @@
+#ifndef BIT_VECTOR_H
+#define BIT_VECTOR_H
+
+#include "Vector.h"
+
+// Mot de stockage de BitVector : la taille des registres de la cible.
+#ifndef ARD_C_BIT_WORD
+	#if defined(__AVR__)
+		#define ARD_C_BIT_WORD uint8_t
+	#elif defined(__SIZEOF_POINTER__) && __SIZEOF_POINTER__ >= 8
+		#define ARD_C_BIT_WORD uint64_t
+	#else
+		#define ARD_C_BIT_WORD uint32_t
+	#endif
+#endif
+
+namespace ard_c
+{
+	// bit_count / bit_ctz
+	// Nombre de bits à 1 et index du bit à 1 le plus faible ( 'w' non nul ), par les builtins
+	// du compilateur : une instruction sur les cibles qui en disposent.
+	inline int bit_count(uint8_t w) { return __builtin_popcount(w); }
+	inline int bit_count(uint16_t w) { return __builtin_popcount(w); }
+	inline int bit_count(uint32_t w) { return __builtin_popcountl(w); }
+	inline int bit_count(uint64_t w) { return __builtin_popcountll(w); }
+	inline int bit_ctz(uint8_t w) { return __builtin_ctz(w); }
+	inline int bit_ctz(uint16_t w) { return __builtin_ctz(w); }
+	inline int bit_ctz(uint32_t w) { return __builtin_ctzl(w); }
+	inline int bit_ctz(uint64_t w) { return __builtin_ctzll(w); }
+
+
+	// BitVector
+	// Tableau de booléens compacté, un bit par valeur dans des mots de ARD_C_BIT_WORD ( 8 bits sur
+	// AVR, 64 sur un hôte 64 bits ) : huit fois moins de RAM qu'un Vector<bool>. count(),
+	// findFirstSet() / findNextSet() et les opérations logiques traitent un mot entier à la fois.
+	// Les bits au-delà de size() dans le dernier mot sont toujours à 0.
+	// operator[] non constant renvoie une référence mandataire ( BitVector::Reference ).
+	// Les mots sont stockés dans un Vector : les copies partagent leurs données ( copy-on-write ).
+	template<typename R = ARD_C_DEFAULT_REFCOUNT, typename A = ARD_C_DEFAULT_ALLOCATOR>
+	class BitVector
+	{
+	public:
+		typedef ARD_C_BIT_WORD word_type;
+		enum { WordBits = sizeof(word_type) * 8 };
+
+	private:
+		Vector<word_type, R, A> _words;
+		int _size;
+
+		static int word_count(int bits) { return (bits + WordBits - 1) / WordBits; }
+		static word_type bit_mask(int i) { return (word_type)((word_type)1 << (i % WordBits)); }
+		// Remet à 0 les bits au-delà de _size dans le dernier mot.
+		void trim()
+		{
+			int r = _size % WordBits;
+			if (r) _words[_words.size() - 1] &= (word_type)(((word_type)1 << r) - 1);
+		}
+
+	public:
+		class Reference
+		{
+			word_type *_w;
+			word_type _mask;
+
+		public:
+			Reference(word_type *w, word_type mask) : _w(w), _mask(mask) {}
+
+			operator bool() const { return (*_w & _mask) != 0; }
+			Reference &operator=(bool value)
+			{
+				if (value) *_w |= _mask;
+				else *_w &= (word_type)~_mask;
+				return *this;
+			}
+			Reference &operator=(const Reference &other) { return *this = (bool)other; }
+			void flip() { *_w ^= _mask; }
+		};
+
+		BitVector() : _size(0) {}
+		BitVector(int size, bool value = false) : _size(0) { resize(size, value); }
+
+		int size() const { return _size; }
+		bool isEmpty() const { return _size == 0; }
+		int capacity() const { return _words.capacity() * WordBits; }
+		void reserve(int bits) { _words.reserve(word_count(bits)); }
+		void clear()
+		{
+			_words.clear();
+			_size = 0;
+		}
+
+		// Les nouveaux bits valent 'value'.
+		void resize(int size, bool value = false)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(size >= 0, "BitVector::resize", "size must be a positive integer");
+#endif
+			const int words = word_count(size);
+			if (size > _size)
+			{
+				if (value && _size % WordBits) _words[_words.size() - 1] |= (word_type)~(word_type)0 << (_size % WordBits);
+				if (words > _words.size()) _words.resize(words, value ? (word_type)~(word_type)0 : (word_type)0);
+			}
+			else _words.resize(words);
+			_size = size;
+			trim();
+		}
+		void fill(bool value)
+		{
+			if (!_size) return;
+			_words.fill(value ? (word_type)~(word_type)0 : (word_type)0);
+			trim();
+		}
+		void append(bool value)
+		{
+			if (_size % WordBits == 0) _words.append((word_type)0);
+			if (value) _words[_words.size() - 1] |= bit_mask(_size);
+			++_size;
+		}
+
+		bool testBit(int i) const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((i >= 0 && i < _size), "BitVector::testBit", "index out of range");
+#endif
+			return (_words.constData()[i / WordBits] & bit_mask(i)) != 0;
+		}
+		bool at(int i) const { return testBit(i); }
+		void setBit(int i)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((i >= 0 && i < _size), "BitVector::setBit", "index out of range");
+#endif
+			_words.data()[i / WordBits] |= bit_mask(i);
+		}
+		void setBit(int i, bool value)
+		{
+			if (value) setBit(i);
+			else clearBit(i);
+		}
+		void clearBit(int i)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((i >= 0 && i < _size), "BitVector::clearBit", "index out of range");
+#endif
+			_words.data()[i / WordBits] &= (word_type)~bit_mask(i);
+		}
+		void toggleBit(int i)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((i >= 0 && i < _size), "BitVector::toggleBit", "index out of range");
+#endif
+			_words.data()[i / WordBits] ^= bit_mask(i);
+		}
+		bool operator[](int i) const { return testBit(i); }
+		Reference operator[](int i)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((i >= 0 && i < _size), "BitVector::operator[]", "index out of range");
+#endif
+			return Reference(_words.data() + i / WordBits, bit_mask(i));
+		}
+
+		// Nombre de bits à 1.
+		int count() const
+		{
+			const word_type *w = _words.constData();
+			const int n = _words.size();
+			int c = 0;
+			for (int i = 0; i < n; ++i) c += bit_count(w[i]);
+			return c;
+		}
+		bool any() const
+		{
+			const word_type *w = _words.constData();
+			const int n = _words.size();
+			for (int i = 0; i < n; ++i)
+				if (w[i]) return true;
+			return false;
+		}
+		bool none() const { return !any(); }
+		bool all() const { return count() == _size; }
+
+		// Index du premier bit à 1, -1 s'il n'y en a pas.
+		int findFirstSet() const { return findFrom(0); }
+		// Index du premier bit à 1 après 'i', -1 s'il n'y en a pas. Parcours des bits à 1 :
+		//     for (int i = b.findFirstSet(); i != -1; i = b.findNextSet(i)) ...
+		int findNextSet(int i) const { return findFrom(i + 1); }
+
+		// Opérations mot à mot entre deux BitVector de même taille.
+		BitVector<R, A> &operator&=(const BitVector<R, A> &other)
+		{
+			word_type *w = combine_data(other);
+			const word_type *o = other._words.constData();
+			for (int i = 0, n = _words.size(); i < n; ++i) w[i] &= o[i];
+			return *this;
+		}
+		BitVector<R, A> &operator|=(const BitVector<R, A> &other)
+		{
+			word_type *w = combine_data(other);
+			const word_type *o = other._words.constData();
+			for (int i = 0, n = _words.size(); i < n; ++i) w[i] |= o[i];
+			return *this;
+		}
+		BitVector<R, A> &operator^=(const BitVector<R, A> &other)
+		{
+			word_type *w = combine_data(other);
+			const word_type *o = other._words.constData();
+			for (int i = 0, n = _words.size(); i < n; ++i) w[i] ^= o[i];
+			return *this;
+		}
+		// Met à 0 les bits à 1 dans 'other' ( this &= ~other, sans copie temporaire ).
+		BitVector<R, A> &andNot(const BitVector<R, A> &other)
+		{
+			word_type *w = combine_data(other);
+			const word_type *o = other._words.constData();
+			for (int i = 0, n = _words.size(); i < n; ++i) w[i] &= (word_type)~o[i];
+			return *this;
+		}
+		// Inverse tous les bits.
+		void invert()
+		{
+			if (!_size) return;
+			word_type *w = _words.data();
+			for (int i = 0, n = _words.size(); i < n; ++i) w[i] = (word_type)~w[i];
+			trim();
+		}
+
+		BitVector<R, A> operator&(const BitVector<R, A> &other) const { BitVector<R, A> r(*this); r &= other; return r; }
+		BitVector<R, A> operator|(const BitVector<R, A> &other) const { BitVector<R, A> r(*this); r |= other; return r; }
+		BitVector<R, A> operator^(const BitVector<R, A> &other) const { BitVector<R, A> r(*this); r ^= other; return r; }
+		BitVector<R, A> operator~() const { BitVector<R, A> r(*this); r.invert(); return r; }
+
+		// Mots de stockage, bit i dans le mot i / WordBits à la position i % WordBits.
+		const Vector<word_type, R, A> &words() const { return _words; }
+
+	private:
+		int findFrom(int i) const
+		{
+			if (i >= _size) return -1;
+			const word_type *w = _words.constData();
+			const int n = _words.size();
+			int k = i / WordBits;
+			// Bits du premier mot situés avant 'i' masqués.
+			word_type cur = (word_type)(w[k] & ((word_type)~(word_type)0 << (i % WordBits)));
+			for (;;)
+			{
+				if (cur) return k * WordBits + bit_ctz(cur);
+				if (++k == n) return -1;
+				cur = w[k];
+			}
+		}
+		word_type *combine_data(const BitVector<R, A> &other)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(_size == other._size, "BitVector", "sizes differ");
+#endif
+			return _words.data();
+		}
+	};
+}
+
+
+#endif // !BIT_VECTOR_H
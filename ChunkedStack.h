@@ -0,0 +1,220 @@
+#ifndef CHUNKED_STACK_H
+#define CHUNKED_STACK_H
+
+#include "Collection_Tool.h"
+#include "Collection_TypeTrait.h"
+#include "Collection_Relocation.h"
+#include "Collection_Allocator.h"
+
+// Taille visée d'un bloc de ChunkedStack, en octets ( au moins 4 éléments par bloc ).
+#ifndef ARD_C_CHUNK_BYTES
+	#if defined(__AVR__)
+		#define ARD_C_CHUNK_BYTES 64
+	#else
+		#define ARD_C_CHUNK_BYTES 1024
+	#endif
+#endif
+
+namespace ard_c
+{
+	// ChunkCapacity
+	// Nombre d'éléments par bloc par défaut.
+	template<typename T>
+	struct ChunkCapacity
+	{
+		enum { value = ARD_C_CHUNK_BYTES / sizeof(T) < 4 ? 4 : ARD_C_CHUNK_BYTES / sizeof(T) };
+	};
+
+
+	// ChunkedStack
+	// Pile formée de blocs de N éléments chaînés : elle grandit en ajoutant un bloc, sans jamais
+	// déplacer les éléments déjà empilés. Pas de pic de latence dû à une réallocation, et
+	// l'adresse d'un élément reste valable jusqu'à ce qu'il soit dépilé.
+	// Le bloc du sommet est gardé en cache : push() / pop() / top() ne font qu'une comparaison
+	// de pointeurs hors changement de bloc. Le dernier bloc libéré est conservé pour qu'une pile
+	// qui oscille autour d'une frontière de bloc n'alloue et ne libère pas à chaque opération.
+	// Tous les blocs ont la même taille : adapté à un PoolAllocator.
+	// Une ChunkedStack n'est pas partagée implicitement : une copie duplique les éléments.
+	template<typename T, int N = ChunkCapacity<T>::value, typename A = ARD_C_DEFAULT_ALLOCATOR>
+	class ChunkedStack
+	{
+		static_assert(N > 0, "ChunkedStack needs a positive chunk size");
+
+		struct Chunk
+		{
+			Chunk *prev;
+			Chunk *next;
+			alignas(T) unsigned char d[sizeof(T) * N];
+
+			T *begin() { return reinterpret_cast<T*>(d); }
+			const T *begin() const { return reinterpret_cast<const T*>(d); }
+			T *end() { return begin() + N; }
+		};
+
+		Chunk *_bottom;
+		// Bloc du sommet. _chunk->next est le bloc de réserve, s'il existe.
+		Chunk *_chunk;
+		T *_top;
+		T *_end;
+		int _size;
+
+	public:
+		ChunkedStack() : _bottom(0), _chunk(0), _top(0), _end(0), _size(0) {}
+		ChunkedStack(const ChunkedStack<T, N, A> &other) : _bottom(0), _chunk(0), _top(0), _end(0), _size(0)
+		{
+			copy_from(other);
+		}
+		~ChunkedStack()
+		{
+			clear();
+			free_chunks(_bottom);
+		}
+
+		static constexpr int chunkSize() { return N; }
+		int size() const { return _size; }
+		bool isEmpty() const { return _size == 0; }
+
+		template<typename... Args>
+		void emplace(Args&&... args)
+		{
+			if (_top == _end)
+			{
+				// Les arguments peuvent référencer un élément de la pile, qui ne bouge pas :
+				// aucune copie préalable n'est nécessaire.
+				next_chunk();
+			}
+			new (_top) T(ard_c::forward<Args>(args)...);
+			++_top;
+			++_size;
+		}
+		void push(const T &value) { emplace(value); }
+		void push(T &&value) { emplace(ard_c::move(value)); }
+
+		T pop()
+		{
+			ASSERT_X(!isEmpty(), "ChunkedStack::pop", "stack is empty");
+			T *p = _top - 1;
+			T r(ard_c::move(*p));
+			p->~T();
+			drop_top(p);
+			return r;
+		}
+		void removeTop()
+		{
+			ASSERT_X(!isEmpty(), "ChunkedStack::removeTop", "stack is empty");
+			T *p = _top - 1;
+			p->~T();
+			drop_top(p);
+		}
+		T &top()
+		{
+			ASSERT_X(!isEmpty(), "ChunkedStack::top", "stack is empty");
+			return _top[-1];
+		}
+		const T &top() const
+		{
+			ASSERT_X(!isEmpty(), "ChunkedStack::top", "stack is empty");
+			return _top[-1];
+		}
+
+		// Détruit les éléments et libère les blocs, sauf celui du bas.
+		void clear()
+		{
+			if (!_bottom) return;
+			while (_size) removeTop();
+			free_chunks(_bottom->next);
+			_bottom->next = 0;
+		}
+
+		ChunkedStack<T, N, A> &operator=(const ChunkedStack<T, N, A> &other)
+		{
+			if (this != &other)
+			{
+				clear();
+				copy_from(other);
+			}
+			return *this;
+		}
+
+
+		// Parcours du bas vers le sommet.
+		class ConstIterator
+		{
+		public:
+			const Chunk *_c;
+			const Chunk *_last;
+			const T *_p;
+			ConstIterator() {}
+			ConstIterator(const Chunk *c, const Chunk *last, const T *p) : _c(c), _last(last), _p(p) {}
+
+			const T &operator*() const { return *_p; }
+			const T *operator->() const { return _p; }
+			bool operator==(const ConstIterator &other) const { return _p == other._p; }
+			bool operator!=(const ConstIterator &other) const { return _p != other._p; }
+			ConstIterator &operator++()
+			{
+				if (++_p == _c->begin() + N && _c != _last)
+				{
+					_c = _c->next;
+					_p = _c->begin();
+				}
+				return *this;
+			}
+			ConstIterator operator++(int) { ConstIterator i = *this; ++*this; return i; }
+		};
+
+		ConstIterator begin() const { return ConstIterator(_bottom, _chunk, _bottom ? _bottom->begin() : 0); }
+		ConstIterator end() const { return ConstIterator(_chunk, _chunk, _top); }
+		ConstIterator cbegin() const { return begin(); }
+		ConstIterator cend() const { return end(); }
+
+	private:
+		// Passe au bloc suivant, en réutilisant le bloc de réserve s'il existe.
+		void next_chunk()
+		{
+			if (_chunk && _chunk->next) _chunk = _chunk->next;
+			else
+			{
+				Chunk *c = reinterpret_cast<Chunk*>(A::allocate(sizeof(Chunk)));
+				ASSERT_X(c, "ChunkedStack::push", "bad alloc");
+				c->prev = _chunk;
+				c->next = 0;
+				if (_chunk) _chunk->next = c;
+				else _bottom = c;
+				_chunk = c;
+			}
+			_top = _chunk->begin();
+			_end = _chunk->end();
+		}
+		// 'p' vient d'être libéré. Un bloc vidé devient la réserve ; l'ancienne réserve est rendue.
+		void drop_top(T *p)
+		{
+			_top = p;
+			--_size;
+			if (p == _chunk->begin() && _chunk->prev)
+			{
+				free_chunks(_chunk->next);
+				_chunk->next = 0;
+				_chunk = _chunk->prev;
+				_top = _end = _chunk->end();
+			}
+		}
+		static void free_chunks(Chunk *c)
+		{
+			while (c)
+			{
+				Chunk *next = c->next;
+				A::deallocate(c, sizeof(Chunk));
+				c = next;
+			}
+		}
+
+		void copy_from(const ChunkedStack<T, N, A> &other)
+		{
+			for (ConstIterator it = other.begin(); it != other.end(); ++it) push(*it);
+		}
+	};
+}
+
+
+#endif // !CHUNKED_STACK_H
@@ -0,0 +1,201 @@
+#ifndef COLLECTION_ALLOCATOR_H
+#define COLLECTION_ALLOCATOR_H
+
+
+#include "Collection_Tool.h"
+
+#include <stddef.h>
+#include <string.h>
+
+namespace ard_c
+{
+	// Politiques d'allocation des conteneurs ( troisième paramètre template de Vector, Queue, Stack ).
+	// Une politique est une classe sans instance exposant :
+	//  - static void *allocate(size_t bytes)                  : 0 en cas d'échec
+	//  - static void *reallocate(void *p, size_t old, size_t bytes) : 0 en cas d'échec, 'p' reste valide
+	//  - static void deallocate(void *p, size_t bytes)
+	// La taille du bloc est toujours rendue à la politique, ce qui permet aux allocateurs
+	// sans en-tête ( arène, pool ) de ne rien stocker par bloc.
+	//
+	// L'état des allocateurs arène et pool est statique : 'Tag' permet de créer plusieurs
+	// instances indépendantes, une par sous-système par exemple.
+	//
+	//     struct FrameTag {};
+	//     typedef ard_c::ArenaAllocator<FrameTag> FrameArena;
+	//     static uint8_t frameBuffer[1024];
+	//     FrameArena::init(frameBuffer, sizeof(frameBuffer));
+	//     ard_c::Vector<int, ard_c::RefCount, FrameArena> v;
+	//     ...
+	//     FrameArena::reset();	// une fois tous les conteneurs de l'arène détruits
+
+	// Alignement garanti par les allocateurs arène et pool.
+	#define ARD_C_ALLOC_ALIGN alignof(long double)
+
+
+	// HeapAllocator
+	// Allocation sur le tas avec malloc / realloc / free. Politique par défaut.
+	struct HeapAllocator
+	{
+		static void *allocate(size_t bytes) { return ::malloc(bytes); }
+		static void *reallocate(void *p, size_t, size_t bytes) { return ::realloc(p, bytes); }
+		static void deallocate(void *p, size_t) { ::free(p); }
+	};
+
+
+	// ArenaAllocator
+	// Allocation par incrément d'un pointeur dans un buffer fourni par l'utilisateur.
+	// deallocate() ne rend la mémoire que pour le dernier bloc alloué, et reallocate()
+	// agrandit ce dernier bloc sur place. reset() libère toute l'arène d'un coup : les
+	// conteneurs qui l'utilisent doivent avoir été détruits avant.
+	template<typename Tag = void>
+	class ArenaAllocator
+	{
+		struct State
+		{
+			unsigned char *buffer;
+			size_t size;
+			size_t top;
+			size_t peak;
+		};
+		static State &state()
+		{
+			static State s;
+			return s;
+		}
+		static size_t align(size_t n) { return (n + ARD_C_ALLOC_ALIGN - 1) & ~(size_t)(ARD_C_ALLOC_ALIGN - 1); }
+		static bool isLast(void *p, size_t bytes)
+		{
+			State &s = state();
+			return static_cast<unsigned char*>(p) + align(bytes) == s.buffer + s.top;
+		}
+
+	public:
+		static void init(void *buffer, size_t size)
+		{
+			State &s = state();
+			size_t shift = align((size_t)buffer) - (size_t)buffer;
+			s.buffer = static_cast<unsigned char*>(buffer) + shift;
+			s.size = size > shift ? size - shift : 0;
+			s.top = 0;
+			s.peak = 0;
+		}
+		static void reset() { state().top = 0; }
+
+		static size_t capacity() { return state().size; }
+		static size_t used() { return state().top; }
+		static size_t peak() { return state().peak; }
+
+		static void *allocate(size_t bytes)
+		{
+			State &s = state();
+			size_t n = align(bytes);
+			if (n > s.size - s.top) return 0;
+			void *p = s.buffer + s.top;
+			s.top += n;
+			if (s.top > s.peak) s.peak = s.top;
+			return p;
+		}
+		static void *reallocate(void *p, size_t old, size_t bytes)
+		{
+			if (!p) return allocate(bytes);
+			State &s = state();
+			if (isLast(p, old))
+			{
+				size_t offset = static_cast<unsigned char*>(p) - s.buffer;
+				size_t n = align(bytes);
+				if (n > s.size - offset) return 0;
+				s.top = offset + n;
+				if (s.top > s.peak) s.peak = s.top;
+				return p;
+			}
+			void *d = allocate(bytes);
+			if (!d) return 0;
+			::memcpy(d, p, old < bytes ? old : bytes);
+			return d;
+		}
+		static void deallocate(void *p, size_t bytes)
+		{
+			if (p && isLast(p, bytes)) state().top -= align(bytes);
+		}
+	};
+
+
+	// PoolAllocator
+	// Blocs de taille fixe 'BlockSize' découpés dans un buffer fourni par l'utilisateur et chaînés
+	// dans une liste libre : allocation et libération en temps constant, sans fragmentation.
+	// Une demande plus grande que BlockSize échoue, un conteneur sur un pool doit donc
+	// réserver sa capacité maximale ( reserve ) et ne pas la dépasser.
+	template<int BlockSize, typename Tag = void>
+	class PoolAllocator
+	{
+		static const size_t stride = ((BlockSize < (int)sizeof(void*) ? sizeof(void*) : BlockSize)
+			+ ARD_C_ALLOC_ALIGN - 1) & ~(size_t)(ARD_C_ALLOC_ALIGN - 1);
+
+		struct State
+		{
+			void *free;
+			size_t blocks;
+			size_t used;
+			size_t peak;
+		};
+		static State &state()
+		{
+			static State s;
+			return s;
+		}
+
+	public:
+		static void init(void *buffer, size_t size)
+		{
+			State &s = state();
+			unsigned char *b = static_cast<unsigned char*>(buffer);
+			size_t shift = (((size_t)b + ARD_C_ALLOC_ALIGN - 1) & ~(size_t)(ARD_C_ALLOC_ALIGN - 1)) - (size_t)b;
+			b += shift;
+			s.blocks = size > shift ? (size - shift) / stride : 0;
+			s.free = 0;
+			s.used = 0;
+			s.peak = 0;
+			for (size_t i = s.blocks; i > 0; --i)
+			{
+				void *block = b + (i - 1) * stride;
+				*static_cast<void**>(block) = s.free;
+				s.free = block;
+			}
+		}
+
+		static constexpr int blockSize() { return BlockSize; }
+		static size_t blocks() { return state().blocks; }
+		static size_t used() { return state().used; }
+		static size_t peak() { return state().peak; }
+
+		static void *allocate(size_t bytes)
+		{
+			State &s = state();
+			if (bytes > (size_t)BlockSize || !s.free) return 0;
+			void *p = s.free;
+			s.free = *static_cast<void**>(p);
+			if (++s.used > s.peak) s.peak = s.used;
+			return p;
+		}
+		static void *reallocate(void *p, size_t, size_t bytes)
+		{
+			if (!p) return allocate(bytes);
+			return bytes <= (size_t)BlockSize ? p : 0;
+		}
+		static void deallocate(void *p, size_t)
+		{
+			if (!p) return;
+			State &s = state();
+			*static_cast<void**>(p) = s.free;
+			s.free = p;
+			--s.used;
+		}
+	};
+}
+
+// Politique d'allocation utilisée par défaut par Vector, Queue et Stack.
+#ifndef ARD_C_DEFAULT_ALLOCATOR
+	#define ARD_C_DEFAULT_ALLOCATOR ard_c::HeapAllocator
+#endif
+
+#endif	// COLLECTION_ALLOCATOR_H
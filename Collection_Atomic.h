@@ -0,0 +1,98 @@
+#ifndef COLLECTION_ATOMIC_H
+#define COLLECTION_ATOMIC_H
+
+
+#include "Collection_Tool.h"
+
+#if defined(__AVR__)
+	#include <avr/io.h>
+	#include <avr/interrupt.h>
+#endif
+
+namespace ard_c
+{
+	// Accès atomiques aux entiers partagés entre une interruption et loop(), ou entre deux threads.
+	//  - AVR : mono-coeur, une lecture ou écriture d'un octet est atomique. Au delà d'un octet
+	//    les interruptions sont masquées le temps de l'accès. Une barrière compilateur suffit
+	//    pour l'ordre acquire / release.
+	//  - ARM, ESP32, host : builtins __atomic de gcc / clang, qui génèrent les barrières matérielles
+	//    nécessaires sur les architectures multi-coeurs.
+
+#if defined(__AVR__)
+
+	class InterruptLock
+	{
+		uint8_t _sreg;
+	public:
+		InterruptLock() : _sreg(SREG) { cli(); }
+		~InterruptLock() { SREG = _sreg; }
+	};
+
+	template<typename T>
+	inline T atomic_load_acquire(const volatile T *p)
+	{
+		T v;
+		if (sizeof(T) == 1) v = *p;
+		else { InterruptLock l; v = *p; }
+		asm volatile("" ::: "memory");
+		return v;
+	}
+	template<typename T>
+	inline T atomic_load_relaxed(const volatile T *p)
+	{
+		if (sizeof(T) == 1) return *p;
+		InterruptLock l;
+		return *p;
+	}
+	template<typename T>
+	inline void atomic_store_release(volatile T *p, T v)
+	{
+		asm volatile("" ::: "memory");
+		if (sizeof(T) == 1) *p = v;
+		else { InterruptLock l; *p = v; }
+	}
+	template<typename T>
+	inline T atomic_fetch_add(volatile T *p, T v)
+	{
+		InterruptLock l;
+		T o = *p;
+		*p = o + v;
+		return o;
+	}
+	template<typename T>
+	inline T atomic_fetch_sub(volatile T *p, T v)
+	{
+		InterruptLock l;
+		T o = *p;
+		*p = o - v;
+		return o;
+	}
+
+#elif defined(__GNUC__) || defined(__clang__)
+
+	template<typename T>
+	inline T atomic_load_acquire(const volatile T *p) { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+	template<typename T>
+	inline T atomic_load_relaxed(const volatile T *p) { return __atomic_load_n(p, __ATOMIC_RELAXED); }
+	template<typename T>
+	inline void atomic_store_release(volatile T *p, T v) { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+	template<typename T>
+	inline T atomic_fetch_add(volatile T *p, T v) { return __atomic_fetch_add(p, v, __ATOMIC_ACQ_REL); }
+	template<typename T>
+	inline T atomic_fetch_sub(volatile T *p, T v) { return __atomic_fetch_sub(p, v, __ATOMIC_ACQ_REL); }
+
+#else
+	#error "Collection_Atomic.h : unsupported compiler, gcc or clang __atomic builtins are required"
+#endif
+
+}
+
+// Aligne une donnée sur une ligne de cache pour éviter le faux partage entre coeurs.
+// Sans effet sur microcontrôleur où la RAM est plus précieuse que le cache.
+#ifdef ARD_C_HOST
+	#define ARD_C_CACHE_ALIGNED alignas(64)
+#else
+	#define ARD_C_CACHE_ALIGNED
+#endif
+
+#endif	// COLLECTION_ATOMIC_H
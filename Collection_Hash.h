@@ -0,0 +1,477 @@
+#ifndef COLLECTION_HASH_H
+#define COLLECTION_HASH_H
+
+
+#include "Collection_Tool.h"
+#include "Collection_Allocator.h"
+#include "TypeTrait.h"
+
+#include <stdint.h>
+#include <string.h>
+
+namespace ard_c
+{
+	// hash_mix32 / hash_mix64
+	// Finaliseurs de MurmurHash3 : chaque bit de l'entrée influence tous les bits du résultat,
+	// les tables en puissance de 2 peuvent donc garder les bits de poids faible.
+	inline uint32_t hash_mix32(uint32_t h)
+	{
+		h ^= h >> 16;
+		h *= 0x85EBCA6BUL;
+		h ^= h >> 13;
+		h *= 0xC2B2AE35UL;
+		h ^= h >> 16;
+		return h;
+	}
+	inline uint32_t hash_mix64(uint64_t h)
+	{
+		h ^= h >> 33;
+		h *= 0xFF51AFD7ED558CCDULL;
+		h ^= h >> 33;
+		h *= 0xC4CEB9FE1A85EC53ULL;
+		h ^= h >> 33;
+		return (uint32_t)h;
+	}
+
+	template<typename T>
+	inline uint32_t hash_value(const T &v, true_type, false_type)
+	{
+		return sizeof(T) <= 4 ? hash_mix32((uint32_t)v) : hash_mix64((uint64_t)v);
+	}
+	template<typename T>
+	inline uint32_t hash_value(const T &v, false_type, true_type)
+	{
+		// 0.0 et -0.0 sont égaux, ils doivent avoir le même hash.
+		if (v == 0) return 0;
+		unsigned char bytes[sizeof(T)];
+		::memcpy(bytes, &v, sizeof(T));
+		uint64_t h = 0;
+		for (unsigned i = 0; i < sizeof(T) && i < 8; ++i) h |= (uint64_t)bytes[i] << (8 * i);
+		for (unsigned i = 8; i < sizeof(T); ++i) h ^= (uint64_t)bytes[i] << (8 * (i - 8));
+		return hash_mix64(h);
+	}
+
+	// Hash
+	// Hash par défaut de HashMap et HashSet, défini pour les types reconnus par is_integral
+	// et is_floating_point. Pour les autres types, spécialiser Hash ou passer un foncteur
+	// 'uint32_t operator()(const K &) const' en paramètre template.
+	template<typename T>
+	struct Hash
+	{
+		static_assert(is_atomic<T>::value, "ard_c::Hash : no built-in hash for this type, provide a hash functor");
+		uint32_t operator()(const T &v) const
+		{
+			return hash_value(v, integral_constant<bool, is_integral<T>::value>(),
+				integral_constant<bool, is_floating_point<T>::value>());
+		}
+	};
+	template<typename T>
+	struct Hash<T*>
+	{
+		uint32_t operator()(T *p) const { return hash_mix64((uint64_t)(size_t)p); }
+	};
+
+
+	// Stockage des valeurs d'une HashTable, vide pour HashSet ( V = void ).
+	template<typename V>
+	struct HashValues
+	{
+		V *_v;
+
+		static size_t bytes(int capacity) { return sizeof(V) * capacity; }
+		static size_t align() { return alignof(V); }
+		void set(void *p) { _v = static_cast<V*>(p); }
+		template<typename... Args>
+		void construct(int i, Args&&... args) { new (_v + i) V(ard_c::forward<Args>(args)...); }
+		void relocate(V *dest, int from)
+		{
+			new (dest) V(ard_c::move(_v[from]));
+			_v[from].~V();
+		}
+		void relocate(int to, int from) { relocate(_v + to, from); }
+		void relocate(int to, HashValues &from, int k) { from.relocate(_v + to, k); }
+		void copy(int to, const HashValues &from, int k) { new (_v + to) V(from._v[k]); }
+		void destroy(int i) { _v[i].~V(); }
+	};
+	template<>
+	struct HashValues<void>
+	{
+		static size_t bytes(int) { return 0; }
+		static size_t align() { return 1; }
+		void set(void *) {}
+		void construct(int) {}
+		void relocate(int, int) {}
+		void relocate(int, HashValues &, int) {}
+		void copy(int, const HashValues &, int) {}
+		void destroy(int) {}
+	};
+
+
+	// HashTable
+	// Base de HashMap et HashSet : adressage ouvert avec sondage linéaire Robin Hood dans une
+	// table en puissance de 2, chargée à 7/8 au plus.
+	// Un octet de métadonnée par case, stocké à part des clés et valeurs, donne la distance
+	// de sondage + 1 de l'élément qui l'occupe ( 0 pour une case vide ) : une recherche
+	// parcourt ces octets et ne lit une clé que lorsque la distance correspond, et s'arrête dès
+	// qu'elle rencontre un élément plus proche de sa case d'origine que la clé cherchée.
+	// Les éléments d'un groupe restent ainsi triés par case d'origine : une insertion décale
+	// le groupe d'une case vers la fin, une suppression le ramène d'une case ( backward shift ),
+	// sans marqueur de case supprimée.
+	// Contrairement à Vector, les tables ne sont pas partagées implicitement : une copie
+	// duplique toujours les éléments.
+	template<typename K, typename V, typename H, typename A>
+	class HashTable
+	{
+	protected:
+		K *_keys;
+		HashValues<V> _values;
+		uint8_t *_meta;
+		int _size;
+		int _capacity;
+		H _hash;
+
+		static size_t align_up(size_t n, size_t a) { return (n + a - 1) & ~(a - 1); }
+		static size_t values_offset(int capacity) { return align_up(sizeof(K) * capacity, HashValues<V>::align()); }
+		static size_t meta_offset(int capacity) { return values_offset(capacity) + HashValues<V>::bytes(capacity); }
+		static size_t block_bytes(int capacity) { return meta_offset(capacity) + capacity; }
+
+	public:
+		HashTable() : _keys(0), _meta(0), _size(0), _capacity(0)
+		{
+			_values.set(0);
+		}
+		HashTable(int alloc) : _keys(0), _meta(0), _size(0), _capacity(0)
+		{
+			_values.set(0);
+			reserve(alloc);
+		}
+		~HashTable()
+		{
+			release();
+		}
+
+		int size() const { return _size; }
+		bool isEmpty() const { return _size == 0; }
+		// Nombre de cases de la table, puissance de 2.
+		int capacity() const { return _capacity; }
+
+		// reserve
+		// Dimensionne la table pour recevoir 'n' éléments sans la reconstruire.
+		void reserve(int n)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(n >= 0, "HashTable::reserve", "allocation must be a positive integer");
+#endif
+			int needed = n + n / 7 + 1;
+			if (needed > _capacity) rehash((int)nextPowerOfTwo(needed - 1));
+		}
+
+		void clear()
+		{
+			for (int i = 0; i < _capacity && _size; ++i)
+			{
+				if (!_meta[i]) continue;
+				destroy_slot(i);
+				_meta[i] = 0;
+				--_size;
+			}
+		}
+
+		bool contains(const K &key) const { return find_slot(key) != -1; }
+
+		// Renvoie false si 'key' était absente.
+		bool remove(const K &key)
+		{
+			int i = find_slot(key);
+			if (i == -1) return false;
+			erase_slot(i);
+			return true;
+		}
+
+		// ConstIterator
+		// Parcourt les cases occupées, dans un ordre qui dépend des hash.
+		class ConstIterator
+		{
+			friend class HashTable;
+		protected:
+			const HashTable *_t;
+			int _i;
+			ConstIterator(const HashTable *t, int i) : _t(t), _i(i) { skip(); }
+			void skip() { while (_i < _t->_capacity && !_t->_meta[_i]) ++_i; }
+
+		public:
+			const K &key() const { return _t->_keys[_i]; }
+			const K &operator*() const { return _t->_keys[_i]; }
+			ConstIterator &operator++() { ++_i; skip(); return *this; }
+			bool operator==(const ConstIterator &other) const { return _i == other._i; }
+			bool operator!=(const ConstIterator &other) const { return _i != other._i; }
+		};
+
+		ConstIterator begin() const { return ConstIterator(this, 0); }
+		ConstIterator end() const { return ConstIterator(this, _capacity); }
+		ConstIterator constBegin() const { return ConstIterator(this, 0); }
+		ConstIterator constEnd() const { return ConstIterator(this, _capacity); }
+
+	protected:
+		HashTable(const HashTable &other) : _keys(0), _meta(0), _size(0), _capacity(0), _hash(other._hash)
+		{
+			_values.set(0);
+			copy(other);
+		}
+		HashTable(HashTable &&other) : _keys(other._keys), _values(other._values), _meta(other._meta),
+			_size(other._size), _capacity(other._capacity), _hash(other._hash)
+		{
+			other._keys = 0;
+			other._values.set(0);
+			other._meta = 0;
+			other._size = 0;
+			other._capacity = 0;
+		}
+		void assign(const HashTable &other)
+		{
+			if (this == &other) return;
+			release();
+			_hash = other._hash;
+			copy(other);
+		}
+		void assign(HashTable &&other)
+		{
+			if (this == &other) return;
+			release();
+			_keys = other._keys;
+			_values = other._values;
+			_meta = other._meta;
+			_size = other._size;
+			_capacity = other._capacity;
+			_hash = other._hash;
+			other._keys = 0;
+			other._values.set(0);
+			other._meta = 0;
+			other._size = 0;
+			other._capacity = 0;
+		}
+
+		// Index de la case de 'key', -1 si elle est absente.
+		int find_slot(const K &key) const
+		{
+			if (!_size) return -1;
+			const int mask = _capacity - 1;
+			int i = (int)(_hash(key) & (uint32_t)mask);
+			for (uint8_t d = 1;; ++d)
+			{
+				uint8_t m = _meta[i];
+				if (m < d) return -1;
+				if (m == d && _keys[i] == key) return i;
+				i = (i + 1) & mask;
+			}
+		}
+
+		// insert_slot
+		// Renvoie la case de 'key'. Si elle est absente, elle est insérée et sa valeur construite
+		// avec 'args', 'inserted' passe alors à true. Renvoie -1 si la table ne peut pas grandir.
+		template<typename... Args>
+		int insert_slot(const K &key, bool &inserted, Args&&... args)
+		{
+			inserted = false;
+			int i = find_slot(key);
+			if (i != -1) return i;
+			if (_size + 1 > _capacity - _capacity / 8 && !grow()) return -1;
+
+			// Une distance de sondage qui déborde se règle en doublant la table, sauf si trop
+			// de clés ont le même hash.
+			const uint32_t h = _hash(key);
+			if ((i = open_slot(h)) == -1 && (!grow(&h) || (i = open_slot(h)) == -1))
+			{
+#ifdef LAUNCH_ASSERT
+				ASSERT_X(false, "HashTable::insert", "too many hash collisions");
+#endif
+				return -1;
+			}
+			new (_keys + i) K(key);
+			_values.construct(i, ard_c::forward<Args>(args)...);
+			++_size;
+			inserted = true;
+			return i;
+		}
+
+		void erase_slot(int i)
+		{
+			const int mask = _capacity - 1;
+			destroy_slot(i);
+			int next = (i + 1) & mask;
+			while (_meta[next] > 1)
+			{
+				new (_keys + i) K(ard_c::move(_keys[next]));
+				_keys[next].~K();
+				_values.relocate(i, next);
+				_meta[i] = _meta[next] - 1;
+				i = next;
+				next = (next + 1) & mask;
+			}
+			_meta[i] = 0;
+			--_size;
+		}
+
+	private:
+		void destroy_slot(int i)
+		{
+			_keys[i].~K();
+			_values.destroy(i);
+		}
+
+		// 'extra' : hash d'un élément qui sera inséré juste après, qui doit lui aussi trouver sa place.
+		bool grow(const uint32_t *extra = 0)
+		{
+			return rehash(_capacity ? _capacity * 2 : 8, extra);
+		}
+
+		// probe
+		// Case où doit aller un élément de hash 'h' dans les métadonnées 'meta' : première case vide,
+		// ou occupée par un élément plus proche de sa case d'origine. 'end' reçoit la première case
+		// vide qui suit, limite du groupe à décaler, et 'd' la distance de sondage + 1 de l'élément.
+		// Renvoie -1 si une distance ne tiendrait plus sur un octet.
+		static int probe(const uint8_t *meta, int mask, uint32_t h, int &end, uint8_t &d)
+		{
+			int i = (int)(h & (uint32_t)mask);
+			d = 1;
+			while (meta[i] >= d)
+			{
+				if (d == 0xFF - 1) return -1;
+				i = (i + 1) & mask;
+				++d;
+			}
+			end = i;
+			while (meta[end])
+			{
+				if (meta[end] == 0xFF - 1) return -1;
+				end = (end + 1) & mask;
+			}
+			return i;
+		}
+
+		// open_slot
+		// Libère la case où doit aller un élément de hash 'h' en décalant d'une case le groupe
+		// qui l'occupe. La case rendue a sa métadonnée à jour mais ni clé ni valeur construite.
+		// Renvoie -1 si une distance de sondage ne tiendrait plus sur un octet.
+		int open_slot(uint32_t h)
+		{
+			const int mask = _capacity - 1;
+			int e;
+			uint8_t d;
+			int i = probe(_meta, mask, h, e, d);
+			if (i == -1) return -1;
+			for (int j = e; j != i; j = (j - 1) & mask)
+			{
+				int from = (j - 1) & mask;
+				new (_keys + j) K(ard_c::move(_keys[from]));
+				_keys[from].~K();
+				_values.relocate(j, from);
+				_meta[j] = _meta[from] + 1;
+			}
+			_meta[i] = d;
+			return i;
+		}
+
+		// rehash
+		// Reconstruit la table sur 'capacity' cases. Si l'élément de hash 'extra' n'y trouve pas sa
+		// place, essaie jusqu'à 4 fois plus grand. En cas d'échec la table reste inchangée.
+		bool rehash(int capacity, const uint32_t *extra = 0)
+		{
+			for (const int limit = capacity * 4;; capacity *= 2)
+			{
+				if (capacity > limit)
+				{
+#ifdef LAUNCH_ASSERT
+					ASSERT_X(false, "HashTable::rehash", "too many hash collisions");
+#endif
+					return false;
+				}
+				unsigned char *block = static_cast<unsigned char*>(A::allocate(block_bytes(capacity)));
+				if (!block)
+				{
+#ifdef LAUNCH_ASSERT
+					ASSERT_X(false, "HashTable::rehash", "bad alloc");
+#endif
+					return false;
+				}
+				// Sans 'extra', la table grandit par manque de place : doubler la table ne peut pas
+				// allonger le plus long sondage ( la fin de chaque groupe ne dépend que des cases
+				// d'origine, et les origines de la nouvelle table se replient sur celles de l'ancienne ).
+				uint8_t *meta = block + meta_offset(capacity);
+				if (!extra) ::memset(meta, 0, capacity);
+				if (!extra || fits(meta, capacity, extra))
+				{
+					K *oldKeys = _keys;
+					HashValues<V> oldValues = _values;
+					uint8_t *oldMeta = _meta;
+					int oldCapacity = _capacity;
+					_keys = reinterpret_cast<K*>(block);
+					_values.set(block + values_offset(capacity));
+					_meta = meta;
+					_capacity = capacity;
+					for (int k = 0; k < oldCapacity; ++k)
+					{
+						if (!oldMeta[k]) continue;
+						int i = open_slot(_hash(oldKeys[k]));
+						new (_keys + i) K(ard_c::move(oldKeys[k]));
+						oldKeys[k].~K();
+						_values.relocate(i, oldValues, k);
+					}
+					if (oldKeys) A::deallocate(oldKeys, block_bytes(oldCapacity));
+					return true;
+				}
+				A::deallocate(block, block_bytes(capacity));
+			}
+		}
+		// Simule, sur les seules métadonnées et dans l'ordre de rehash(), la réinsertion de tous
+		// les éléments ( puis de 'extra' ) dans une table de 'capacity' cases. 'meta' est laissé à zéro.
+		bool fits(uint8_t *meta, int capacity, const uint32_t *extra) const
+		{
+			const int mask = capacity - 1;
+			bool ok = true;
+			::memset(meta, 0, capacity);
+			for (int k = 0; k <= _capacity && ok; ++k)
+			{
+				if (k == _capacity ? !extra : !_meta[k]) continue;
+				int e;
+				uint8_t d;
+				int i = probe(meta, mask, k == _capacity ? *extra : _hash(_keys[k]), e, d);
+				if (i == -1) ok = false;
+				else
+				{
+					for (int j = e; j != i; j = (j - 1) & mask) meta[j] = meta[(j - 1) & mask] + 1;
+					meta[i] = d;
+				}
+			}
+			::memset(meta, 0, capacity);
+			return ok;
+		}
+
+		void copy(const HashTable &other)
+		{
+			if (!other._size || !rehash(other._capacity)) return;
+			for (int k = 0; k < other._capacity; ++k)
+			{
+				if (!other._meta[k]) continue;
+				const uint32_t h = _hash(other._keys[k]);
+				// Même ensemble de cases d'origine que 'other' : les distances y tiennent déjà.
+				int i = open_slot(h);
+				new (_keys + i) K(other._keys[k]);
+				_values.copy(i, other._values, k);
+				++_size;
+			}
+		}
+
+		void release()
+		{
+			clear();
+			if (_keys) A::deallocate(_keys, block_bytes(_capacity));
+			_keys = 0;
+			_values.set(0);
+			_meta = 0;
+			_capacity = 0;
+		}
+	};
+}
+
+#endif	// COLLECTION_HASH_H
@@ -0,0 +1,149 @@
+#ifndef COLLECTION_INSTRUMENT_H
+#define COLLECTION_INSTRUMENT_H
+
+
+// Instrumentation optionnelle des conteneurs, activée en définissant ARD_C_INSTRUMENT
+// avant d'inclure la librairie. Désactivée, elle ne coûte ni code ni RAM.
+//
+// Chaque data interne ( VectorData, QueueData, DequeData ) porte ses propres compteurs, accessibles
+// par la méthode stats() du conteneur, et des totaux globaux sont tenus par type de conteneur
+// ( globalStats() ). dump() écrit les compteurs sur un Print ( Serial sur la carte, stdout
+// sur le build host ), dumpJson() au format JSON.
+//
+// ARD_C_INSTRUMENT doit être défini de la même façon dans toutes les unités de compilation
+// d'un programme : la taille de VectorData, QueueData et DequeData en dépend.
+
+#ifdef ARD_C_INSTRUMENT
+
+#include "Collection_Tool.h"
+
+namespace ard_c
+{
+	struct ContainerStats
+	{
+		// Allocations d'un bloc neuf ( en-tête ou buffer ).
+		unsigned long allocations;
+		// Redimensionnements d'un buffer existant.
+		unsigned long reallocations;
+		// Deep copy déclenchées par detach() sur une data partagée.
+		unsigned long detaches;
+		// Octets alloués et pas encore libérés, et leur maximum.
+		unsigned long bytesLive;
+		unsigned long peakBytes;
+		// Octets déplacés pour ouvrir ou refermer un trou ( insert, prepend, remove ) ou dérouler un buffer circulaire.
+		unsigned long movedBytes;
+
+		void allocated(unsigned long bytes)
+		{
+			++allocations;
+			add(bytes);
+		}
+		void reallocated(unsigned long oldBytes, unsigned long bytes)
+		{
+			++reallocations;
+			bytesLive -= oldBytes;
+			add(bytes);
+		}
+		void freed(unsigned long bytes) { bytesLive -= bytes; }
+		void moved(unsigned long bytes) { movedBytes += bytes; }
+		void detached() { ++detaches; }
+
+		// Une data issue d'un detach() reprend l'historique de celle qu'elle remplace,
+		// sa mémoire vivante reste la sienne.
+		void inherit(const ContainerStats &from)
+		{
+			allocations += from.allocations;
+			reallocations += from.reallocations;
+			detaches = from.detaches + 1;
+			movedBytes += from.movedBytes;
+			if (from.peakBytes > peakBytes) peakBytes = from.peakBytes;
+		}
+
+		void dump(Print &out, const char *name) const
+		{
+			out.print(name);
+			out.print(" : allocations=");
+			out.print(allocations);
+			out.print(" reallocations=");
+			out.print(reallocations);
+			out.print(" detaches=");
+			out.print(detaches);
+			out.print(" bytes=");
+			out.print(bytesLive);
+			out.print(" peak=");
+			out.print(peakBytes);
+			out.print(" moved=");
+			out.println(movedBytes);
+		}
+		void dumpJson(Print &out) const
+		{
+			out.print("{ \"allocations\": ");
+			out.print(allocations);
+			out.print(", \"reallocations\": ");
+			out.print(reallocations);
+			out.print(", \"detaches\": ");
+			out.print(detaches);
+			out.print(", \"bytes\": ");
+			out.print(bytesLive);
+			out.print(", \"peak\": ");
+			out.print(peakBytes);
+			out.print(", \"moved\": ");
+			out.print(movedBytes);
+			out.print(" }");
+		}
+
+	private:
+		void add(unsigned long bytes)
+		{
+			bytesLive += bytes;
+			if (bytesLive > peakBytes) peakBytes = bytesLive;
+		}
+	};
+
+	struct GlobalStats
+	{
+		ContainerStats vector;
+		ContainerStats queue;
+		ContainerStats deque;
+
+		void dump(Print &out) const
+		{
+			vector.dump(out, "vector");
+			queue.dump(out, "queue");
+			deque.dump(out, "deque");
+		}
+		void dumpJson(Print &out) const
+		{
+			out.print("{ \"vector\": ");
+			vector.dumpJson(out);
+			out.print(", \"queue\": ");
+			queue.dumpJson(out);
+			out.print(", \"deque\": ");
+			deque.dumpJson(out);
+			out.println(" }");
+		}
+	};
+
+	inline GlobalStats &globalStats()
+	{
+		static GlobalStats s = GlobalStats();
+		return s;
+	}
+
+	inline void resetGlobalStats()
+	{
+		globalStats() = GlobalStats();
+	}
+}
+
+// Enregistre l'opération 'op' dans les compteurs de la data 'data' et dans les totaux 'kind'.
+// Les arguments ne sont pas évalués quand l'instrumentation est désactivée.
+#define ARD_C_STATS(data, kind, op) ((data)->_stats.op, ard_c::globalStats().kind.op)
+
+#else
+
+#define ARD_C_STATS(data, kind, op) ((void)0)
+
+#endif	// ARD_C_INSTRUMENT
+
+#endif	// COLLECTION_INSTRUMENT_H
@@ -0,0 +1,164 @@
+#ifndef COLLECTION_RELOCATION_H
+#define COLLECTION_RELOCATION_H
+
+
+#include "Collection_Tool.h"
+#include "Collection_TypeTrait.h"
+
+namespace ard_c
+{
+	// Opérations sur des plages d'éléments en mémoire brute, utilisées par les conteneurs.
+	// Le chemin est choisi à la compilation d'après TypeTrait<T> :
+	//  - isRelocatable : un élément peut être déplacé octet par octet ( memmove / realloc ).
+	//  - isPrimitive : un élément peut être copié octet par octet ( memcpy ) et n'a pas de destructeur.
+	// Ces traits peuvent être déclarés pour les types utilisateur avec ARD_C_DECLARE_TYPEINFO.
+	// Les autres types sont déplacés par move-construct + destruction, et copiés élément par élément.
+
+	// relocate_n
+	// Déplace 'n' éléments de 'src' vers 'dest'. Les deux plages peuvent se chevaucher,
+	// les emplacements de 'src' qui ne sont pas recouverts par 'dest' deviennent de la mémoire brute.
+	template<typename T>
+	inline void relocate_n(T *dest, T *src, int n, true_type)
+	{
+		::memmove(static_cast<void*>(dest), static_cast<const void*>(src), sizeof(T) * n);
+	}
+	template<typename T>
+	inline void relocate_n(T *dest, T *src, int n, false_type)
+	{
+		if (dest == src || n <= 0) return;
+		if (dest < src)
+		{
+			for (int i = 0; i < n; ++i)
+			{
+				new (dest + i) T(ard_c::move(src[i]));
+				src[i].~T();
+			}
+		}
+		else
+		{
+			for (int i = n - 1; i >= 0; --i)
+			{
+				new (dest + i) T(ard_c::move(src[i]));
+				src[i].~T();
+			}
+		}
+	}
+	template<typename T>
+	inline void relocate_n(T *dest, T *src, int n)
+	{
+		relocate_n(dest, src, n, integral_constant<bool, TypeTrait<T>::isRelocatable>());
+	}
+
+
+	// reallocate
+	// Redimensionne avec la politique d'allocation 'A' le buffer 'd' contenant 'size' éléments,
+	// de 'capacity' à 'newCapacity' éléments. Renvoie 0 en cas d'échec, 'd' est alors toujours valide.
+	template<typename A, typename T>
+	inline T *reallocate(T *d, int, int capacity, int newCapacity, true_type)
+	{
+		return reinterpret_cast<T*>(A::reallocate(static_cast<void*>(d), sizeof(T) * capacity, sizeof(T) * newCapacity));
+	}
+	template<typename A, typename T>
+	inline T *reallocate(T *d, int size, int capacity, int newCapacity, false_type)
+	{
+		T *n = reinterpret_cast<T*>(A::allocate(sizeof(T) * newCapacity));
+		if (!n) return 0;
+		relocate_n(n, d, size, false_type());
+		A::deallocate(static_cast<void*>(d), sizeof(T) * capacity);
+		return n;
+	}
+	template<typename A, typename T>
+	inline T *reallocate(T *d, int size, int capacity, int newCapacity)
+	{
+		return reallocate<A>(d, size, capacity, newCapacity, integral_constant<bool, TypeTrait<T>::isRelocatable>());
+	}
+
+
+	// copy_construct_n
+	// Construit dans la mémoire brute 'dest' une copie des 'n' éléments de 'src'.
+	template<typename T>
+	inline void copy_construct_n(T *dest, const T *src, int n, true_type)
+	{
+		::memcpy(static_cast<void*>(dest), static_cast<const void*>(src), sizeof(T) * n);
+	}
+	template<typename T>
+	inline void copy_construct_n(T *dest, const T *src, int n, false_type)
+	{
+		for (int i = 0; i < n; ++i) new (dest + i) T(src[i]);
+	}
+	template<typename T>
+	inline void copy_construct_n(T *dest, const T *src, int n)
+	{
+		copy_construct_n(dest, src, n, integral_constant<bool, TypeTrait<T>::isPrimitive>());
+	}
+
+
+	// move_out_n
+	// Déplace par affectation les 'n' éléments de 'src' vers les éléments déjà construits de 'dest',
+	// puis détruit ceux de 'src' qui deviennent de la mémoire brute.
+	template<typename T>
+	inline void move_out_n(T *dest, T *src, int n, true_type)
+	{
+		::memcpy(static_cast<void*>(dest), static_cast<const void*>(src), sizeof(T) * n);
+	}
+	template<typename T>
+	inline void move_out_n(T *dest, T *src, int n, false_type)
+	{
+		for (int i = 0; i < n; ++i)
+		{
+			dest[i] = ard_c::move(src[i]);
+			src[i].~T();
+		}
+	}
+	template<typename T>
+	inline void move_out_n(T *dest, T *src, int n)
+	{
+		move_out_n(dest, src, n, integral_constant<bool, TypeTrait<T>::isPrimitive>());
+	}
+
+
+	// copy_assign_n
+	// Affecte aux 'n' éléments déjà construits de 'dest' une copie des éléments de 'src'.
+	template<typename T>
+	inline void copy_assign_n(T *dest, const T *src, int n, true_type)
+	{
+		::memcpy(static_cast<void*>(dest), static_cast<const void*>(src), sizeof(T) * n);
+	}
+	template<typename T>
+	inline void copy_assign_n(T *dest, const T *src, int n, false_type)
+	{
+		for (int i = 0; i < n; ++i) dest[i] = src[i];
+	}
+	template<typename T>
+	inline void copy_assign_n(T *dest, const T *src, int n)
+	{
+		copy_assign_n(dest, src, n, integral_constant<bool, TypeTrait<T>::isPrimitive>());
+	}
+
+
+	// fill_construct_n
+	// Construit dans la mémoire brute 'dest' 'n' copies de 'value'.
+	template<typename T>
+	inline void fill_construct_n(T *dest, const T &value, int n)
+	{
+		for (int i = 0; i < n; ++i) new (dest + i) T(value);
+	}
+
+
+	// destroy_n
+	// Appelle le destructeur des 'n' éléments de 'd', sans libérer la mémoire.
+	template<typename T>
+	inline void destroy_n(T *, int, true_type) {}
+	template<typename T>
+	inline void destroy_n(T *d, int n, false_type)
+	{
+		for (int i = 0; i < n; ++i) d[i].~T();
+	}
+	template<typename T>
+	inline void destroy_n(T *d, int n)
+	{
+		destroy_n(d, n, integral_constant<bool, TypeTrait<T>::isPrimitive>());
+	}
+}
+
+#endif	// COLLECTION_RELOCATION_H
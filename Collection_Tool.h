@@ -1,4 +1,3 @@
-
 #ifndef COLLECTION_TOOL_H
 #define COLLECTION_TOOL_H
 
@@ -8,7 +7,7 @@
 namespace ard_c {
 
 	inline void no_assert(void) {}
-	void assert(const char *assertion, const char *file, int line)
+	inline void assert_failed(const char *assertion, const char *file, int line)
 	{
 		Serial.print(assertion);
 		Serial.print(" | file : ");
@@ -18,7 +17,7 @@ namespace ard_c {
 		delay(50);
 		abort();
 	}
-	void assert_x(const char *where, const char *what, const char *file, int line)
+	inline void assert_x(const char *where, const char *what, const char *file, int line)
 	{
 		Serial.print(where);
 		Serial.print(" : ");
@@ -32,11 +31,33 @@ namespace ard_c {
 	}
 
 
-#define ASSERT(condition) ((!(condition)) ? assert(#condition,__FILE__,__LINE__) : no_assert())
+#define ASSERT(condition) ((!(condition)) ? assert_failed(#condition,__FILE__,__LINE__) : no_assert())
 #define ASSERT_X(condition, where, what) ((!(condition)) ? assert_x(where,what,__FILE__,__LINE__) : no_assert())
 
 
-	unsigned int nextPowerOfTwo(unsigned int a)
+	// asConst
+	// Renvoie une référence constante sur 'v'. Permet de parcourir un conteneur partagé
+	// avec une boucle for( : ) sans déclencher de detach().
+	template<typename T>
+	inline const T &asConst(T &v) { return v; }
+	template<typename T>
+	void asConst(const T &&) = delete;
+
+
+	// ConstRange
+	// Paire d'itérateurs constants utilisable dans une boucle for( : ).
+	template<typename It>
+	struct ConstRange
+	{
+		It _begin;
+		It _end;
+
+		It begin() const { return _begin; }
+		It end() const { return _end; }
+	};
+
+
+	inline unsigned int nextPowerOfTwo(unsigned int a)
 	{
 		a |= a >> 1;
 		a |= a >> 2;
@@ -49,9 +70,13 @@ namespace ard_c {
 
 }
 
-void *operator new(size_t s, void *dest)
+// Le shim host (host/arduino.h) inclut <new> qui fourni déjà le placement new.
+#ifndef ARD_C_HOST
+inline void *operator new(size_t s, void *dest)
 {
 	return dest;
 }
+#endif
 
 #endif	// COLLECTION_TOOL_H
+
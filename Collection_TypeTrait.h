@@ -3,10 +3,54 @@
 #define COLLECTION_TYPETRAIT_H
 
 
+#include <stdint.h>
 #include "TypeTrait.h"
 
 namespace ard_c
 {
+	// Flags utilisables avec ARD_C_DECLARE_TYPEINFO :
+	//  - ARD_C_PRIMITIVE_TYPE : copie par memcpy, pas de destructeur à appeler.
+	//  - ARD_C_RELOCATABLE_TYPE : déplaçable par memmove / realloc, mais copie et destruction normales.
+	//  - ARD_C_MOVABLE_TYPE : synonyme de ARD_C_RELOCATABLE_TYPE.
+	//  - ARD_C_COMPLEX_TYPE : aucune hypothèse, chaque élément est construit, déplacé et détruit.
+	enum
+	{
+		ARD_C_COMPLEX_TYPE = 0x0,
+		ARD_C_PRIMITIVE_TYPE = 0x1,
+		ARD_C_RELOCATABLE_TYPE = 0x2,
+		ARD_C_MOVABLE_TYPE = ARD_C_RELOCATABLE_TYPE
+	};
+
+	// TypeInfo
+	// Point de spécialisation des types utilisateur. Par défaut le compilateur détecte
+	// les types trivialement copiables, ARD_C_DECLARE_TYPEINFO permet d'imposer les flags.
+	template<typename T>
+	class TypeInfo
+	{
+	public:
+		enum
+		{
+			isPrimitive = is_trivially_copyable<T>::value,
+			isRelocatable = isPrimitive
+		};
+	};
+
+#define ARD_C_DECLARE_TYPEINFO(TYPE, FLAGS) \
+	namespace ard_c \
+	{ \
+		template<> \
+		class TypeInfo<TYPE> \
+		{ \
+		public: \
+			enum \
+			{ \
+				isPrimitive = ((FLAGS) & ARD_C_PRIMITIVE_TYPE) != 0, \
+				isRelocatable = ((FLAGS) & (ARD_C_PRIMITIVE_TYPE | ARD_C_RELOCATABLE_TYPE)) != 0 \
+			}; \
+		}; \
+	}
+
+
 	template<typename T>
 	class TypeTrait
 	{
@@ -17,6 +61,8 @@ namespace ard_c
 			isPointer = false,
 			isAtomic = is_atomic<T>::value,
 			isComplex = !is_enum<T>::value && !isAtomic,
+			isPrimitive = isAtomic || isStatic || TypeInfo<T>::isPrimitive,
+			isRelocatable = isPrimitive || TypeInfo<T>::isRelocatable,
 			isLarge = sizeof(T) > sizeof(void*),
 			sizeOf = sizeof(T)
 		};
@@ -32,6 +78,8 @@ namespace ard_c
 			isPointer = true,
 			isAtomic = false,
 			isComplex = false,
+			isPrimitive = true,
+			isRelocatable = true,
 			isLarge = false,
 			sizeOf = sizeof(T*)
 		};
@@ -47,10 +95,23 @@ namespace ard_c
 			isPointer = false,
 			isAtomic = false,
 			isComplex = false,
+			isPrimitive = false,
+			isRelocatable = false,
 			isLarge = false,
 			sizeOf = 0
 		};
 	};
+
+
+	// SizeType
+	// Plus petit type entier non signé capable de représenter les valeurs 0 à N.
+	// Utilisé par les conteneurs à capacité fixe pour économiser la RAM.
+	template<unsigned long N>
+	struct SizeType
+	{
+		typedef typename conditional<(N < 256UL), uint8_t,
+			typename conditional<(N < 65536UL), uint16_t, uint32_t>::type>::type type;
+	};
 }
 
 #endif	// COLLECTION_TYPETRAIT_H
@@ -0,0 +1,583 @@
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include "Vector.h"
+
+namespace ard_c
+{
+
+	template<typename T, typename R = ARD_C_DEFAULT_REFCOUNT, typename A = ARD_C_DEFAULT_ALLOCATOR>
+	struct DequeData
+	{
+		R _ref;
+		int _size;
+		int _capacity;
+		// Index du premier élément : [ 0, _begin ) et [ _begin + _size, _capacity ) sont libres.
+		int _begin;
+		T *_d;
+#ifdef ARD_C_INSTRUMENT
+		ContainerStats _stats;
+#endif
+
+
+		static DequeData<T, R, A> *create()
+		{
+			void *p = A::allocate(sizeof(DequeData<T, R, A>));
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(p, "DequeData::create", "bad alloc");
+#endif
+			DequeData<T, R, A> *d = new (p) DequeData<T, R, A>();
+			d->_ref = R::init_ref();
+			d->_size = 0;
+			d->_capacity = 0;
+			d->_begin = 0;
+			d->_d = 0;
+			ARD_C_STATS(d, deque, allocated(sizeof(DequeData<T, R, A>)));
+			return d;
+		}
+		static void destroy(DequeData<T, R, A> *d)
+		{
+			d->clear();
+			ARD_C_STATS(d, deque, freed(sizeof(DequeData<T, R, A>)));
+			d->~DequeData<T, R, A>();
+			A::deallocate(d, sizeof(DequeData<T, R, A>));
+		}
+
+
+		// make_room
+		// Libère au moins une place devant ( front ) ou derrière. Si plus de la moitié du buffer est
+		// libre, les éléments sont recentrés sans réallocation : le décalage en O( n ) laisse au
+		// moins n / 2 places de chaque côté, d'où un coût amorti constant.
+		void make_room(bool front)
+		{
+			const int spare = _capacity - _size;
+			if (spare > _size)
+			{
+				int b = front ? spare - spare / 2 : spare / 2;
+				relocate_n(_d + b, _d + _begin, _size);
+				ARD_C_STATS(this, deque, moved(sizeof(T) * _size));
+				_begin = b;
+				return;
+			}
+			realloc(_capacity ? (int)nextPowerOfTwo(_capacity) : 4, front);
+		}
+		// La place libre de l'autre côté est conservée ( dans la limite de la moitié ) : une
+		// Deque utilisée comme une pile ou comme un Vector ne gaspille pas la moitié du buffer.
+		void realloc(int growth, bool front)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(growth >= _size, "DequeData::realloc", "allocation too small");
+#endif
+			const int spare = growth - _size;
+			int keep = front ? _capacity - _begin - _size : _begin;
+			if (keep > spare / 2) keep = spare / 2;
+			const int b = front ? spare - keep : keep;
+			T *d = reinterpret_cast<T*>(A::allocate(sizeof(T) * growth));
+			if (!d) failed_alloc_purge();
+			else if (_capacity)
+			{
+				relocate_n(d + b, _d + _begin, _size);
+				A::deallocate(_d, sizeof(T) * _capacity);
+				ARD_C_STATS(this, deque, reallocated(sizeof(T) * _capacity, sizeof(T) * growth));
+			}
+			else ARD_C_STATS(this, deque, allocated(sizeof(T) * growth));
+			_d = d;
+			_capacity = growth;
+			_begin = b;
+		}
+		// Capacité exacte, comme Vector.
+		void reserve(int n)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(n >= 0, "DequeData::reserve", "allocation must be a positive integer");
+#endif
+			if (n > _capacity) realloc(n, false);
+		}
+		void failed_alloc_purge()
+		{
+			A::deallocate(_d, sizeof(T) * _capacity);
+			ARD_C_STATS(this, deque, freed(sizeof(T) * _capacity));
+			_capacity = 0;
+			_size = 0;
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(false, "DequeData::realloc", "bad alloc");
+#endif
+		}
+
+
+		void *deep_copy()
+		{
+			DequeData<T, R, A> *dest = create();
+			if (!_capacity) return dest;
+			T *d = reinterpret_cast<T*>(A::allocate(sizeof(T) * _capacity));
+			if (!d) failed_alloc_purge();
+			ARD_C_STATS(dest, deque, allocated(sizeof(T) * _capacity));
+			copy_construct_n(d + _begin, _d + _begin, _size);
+			dest->_d = d;
+			dest->_capacity = _capacity;
+			dest->_begin = _begin;
+			dest->_size = _size;
+			return dest;
+		}
+
+		// Les champs sont lus une seule fois : l'écriture d'un élément pourrait sinon forcer leur
+		// relecture, le compilateur ne pouvant prouver que le buffer ne recouvre pas l'en-tête.
+		template<typename... Args>
+		void emplaceBack(Args&&... args)
+		{
+			int size = _size;
+			int end = _begin + size;
+			if (end == _capacity)
+			{
+				// Les arguments peuvent référencer un élément : la valeur est construite avant
+				// que le recentrage ou la réallocation ne les invalide.
+				T t(ard_c::forward<Args>(args)...);
+				make_room(false);
+				new (_d + _begin + _size) T(ard_c::move(t));
+				++_size;
+				return;
+			}
+			new (_d + end) T(ard_c::forward<Args>(args)...);
+			_size = size + 1;
+		}
+		template<typename... Args>
+		void emplaceFront(Args&&... args)
+		{
+			if (_begin == 0)
+			{
+				T t(ard_c::forward<Args>(args)...);
+				make_room(true);
+				new (_d + _begin - 1) T(ard_c::move(t));
+				--_begin;
+				++_size;
+				return;
+			}
+			int begin = _begin - 1;
+			int size = _size;
+			new (_d + begin) T(ard_c::forward<Args>(args)...);
+			_begin = begin;
+			_size = size + 1;
+		}
+		// Insertion au milieu : le côté le plus court est décalé.
+		template<typename... Args>
+		void emplace(int i, Args&&... args)
+		{
+			T t(ard_c::forward<Args>(args)...);
+			if (i < _size / 2)
+			{
+				if (_begin == 0) make_room(true);
+				relocate_n(_d + _begin - 1, _d + _begin, i);
+				ARD_C_STATS(this, deque, moved(sizeof(T) * i));
+				--_begin;
+			}
+			else
+			{
+				if (_begin + _size == _capacity) make_room(false);
+				relocate_n(_d + _begin + i + 1, _d + _begin + i, _size - i);
+				ARD_C_STATS(this, deque, moved(sizeof(T) * (_size - i)));
+			}
+			new (_d + _begin + i) T(ard_c::move(t));
+			++_size;
+		}
+
+		void append(const T *range, int size)
+		{
+			const int n = _size + size;
+			if (_begin + n > _capacity)
+			{
+				// Comme make_room() : on ne tasse en place que si le buffer reste à moitié libre.
+				if (2 * n <= _capacity)
+				{
+					relocate_n(_d, _d + _begin, _size);
+					ARD_C_STATS(this, deque, moved(sizeof(T) * _size));
+					_begin = 0;
+				}
+				else
+				{
+					int growth = (int)nextPowerOfTwo(n - 1);
+					if (growth <= _capacity) growth = (int)nextPowerOfTwo(_capacity);
+					// realloc() garde jusqu'à la moitié de la place libre devant : le buffer doit
+					// aussi la contenir.
+					while ((_begin < (growth - _size) / 2 ? _begin : (growth - _size) / 2) + n > growth)
+						growth = (int)nextPowerOfTwo(growth);
+					realloc(growth, false);
+				}
+			}
+			copy_construct_n(_d + _begin + _size, range, size);
+			_size += size;
+		}
+
+		void removeFirst()
+		{
+			int begin = _begin;
+			int size = _size;
+			destroy_n(_d + begin, 1);
+			_begin = begin + 1;
+			_size = size - 1;
+		}
+		void removeLast()
+		{
+			int size = _size - 1;
+			destroy_n(_d + _begin + size, 1);
+			_size = size;
+		}
+		// Retire [ i, i + n ) en décalant le côté le plus court.
+		void remove(int i, int n)
+		{
+			T *d = _d + _begin;
+			destroy_n(d + i, n);
+			int after = _size - i - n;
+			if (i < after)
+			{
+				relocate_n(d + n, d, i);
+				ARD_C_STATS(this, deque, moved(sizeof(T) * i));
+				_begin += n;
+			}
+			else
+			{
+				relocate_n(d + i, d + i + n, after);
+				ARD_C_STATS(this, deque, moved(sizeof(T) * after));
+			}
+			_size -= n;
+		}
+		T take(int i)
+		{
+			T t(ard_c::move(_d[_begin + i]));
+			if (i == 0) removeFirst();
+			else if (i == _size - 1) removeLast();
+			else remove(i, 1);
+			return t;
+		}
+		T takeFirst()
+		{
+			T *p = _d + _begin;
+			T t(ard_c::move(*p));
+			removeFirst();
+			return t;
+		}
+		T takeLast()
+		{
+			T *p = _d + _begin + _size - 1;
+			T t(ard_c::move(*p));
+			removeLast();
+			return t;
+		}
+		void truncate()
+		{
+			destroy_n(_d + _begin, _size);
+			_size = 0;
+			_begin = 0;
+		}
+
+		T &at(int i) { return _d[_begin + i]; }
+		const T &at(int i) const { return _d[_begin + i]; }
+
+		void clear()
+		{
+			destroy_n(_d + _begin, _size);
+			A::deallocate(_d, sizeof(T) * _capacity);
+			ARD_C_STATS(this, deque, freed(sizeof(T) * _capacity));
+		}
+	};
+
+
+	// Deque
+	// File double à accès direct : les éléments sont contigus dans un buffer qui garde de la place
+	// libre aux deux extrémités ( "devector" ). append() / prepend() et removeFirst() /
+	// removeLast() sont en O( 1 ) amorti, là où Vector::prepend() et Vector::removeFirst()
+	// décalent tout le contenu. at() ne coûte qu'une addition, sans modulo ni table de blocs, et
+	// data() donne les éléments d'un seul tenant. insert() et remove() au milieu décalent le côté
+	// le plus court. Mêmes conventions que Vector : copy-on-write, itérateurs sur pointeur.
+	template<typename T, typename R = ARD_C_DEFAULT_REFCOUNT, typename A = ARD_C_DEFAULT_ALLOCATOR>
+	class Deque
+	{
+		DequeData<T, R, A> *_d;
+
+	public:
+		typedef typename Vector<T, R, A>::Iterator Iterator;
+		typedef typename Vector<T, R, A>::ConstIterator ConstIterator;
+
+		Deque()
+		{
+			construct_data();
+		}
+		Deque(int alloc)
+		{
+			construct_data();
+			reserve(alloc);
+		}
+		Deque(const Deque<T, R, A> &other) : _d(other._d)
+		{
+			if (R::isShareable) _d->_ref.ref();
+			else _d = reinterpret_cast<DequeData<T, R, A>*>(other._d->deep_copy());
+		}
+		~Deque()
+		{
+			release();
+		}
+
+		int size() const { return _d->_size; }
+		bool isEmpty() const { return _d->_size == 0; }
+		int capacity() const { return _d->_capacity; }
+
+		T *data() { detach(); return _d->_d + _d->_begin; }
+		const T *data() const { return _d->_d + _d->_begin; }
+		const T *constData() const { return _d->_d + _d->_begin; }
+		const T &at(int index) const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((index < _d->_size && index >= 0), "Deque::at", "index out of range");
+#endif
+			return _d->at(index);
+		}
+		T &first()
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "Deque::first", "deque is empty");
+#endif
+			detach();
+			return _d->at(0);
+		}
+		const T &first() const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "Deque::first", "deque is empty");
+#endif
+			return _d->at(0);
+		}
+		T &last()
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "Deque::last", "deque is empty");
+#endif
+			detach();
+			return _d->at(_d->_size - 1);
+		}
+		const T &last() const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "Deque::last", "deque is empty");
+#endif
+			return _d->at(_d->_size - 1);
+		}
+
+		void reserve(int alloc)
+		{
+			detach();
+			_d->reserve(alloc);
+		}
+
+		void append(const T &value)
+		{
+			detach();
+			_d->emplaceBack(value);
+		}
+		void append(T &&value)
+		{
+			detach();
+			_d->emplaceBack(ard_c::move(value));
+		}
+		void append(const T *range, int n)
+		{
+			if (n <= 0) return;
+			detach();
+			_d->append(range, n);
+		}
+		void prepend(const T &value)
+		{
+			detach();
+			_d->emplaceFront(value);
+		}
+		void prepend(T &&value)
+		{
+			detach();
+			_d->emplaceFront(ard_c::move(value));
+		}
+		template<typename... Args>
+		void emplaceBack(Args&&... args)
+		{
+			detach();
+			_d->emplaceBack(ard_c::forward<Args>(args)...);
+		}
+		template<typename... Args>
+		void emplaceFront(Args&&... args)
+		{
+			detach();
+			_d->emplaceFront(ard_c::forward<Args>(args)...);
+		}
+		void insert(const T &value, int before)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((before >= 0 && before < _d->_size + 1), "Deque::insert", "index out of range");
+#endif
+			detach();
+			_d->emplace(before, value);
+		}
+		void insert(T &&value, int before)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((before >= 0 && before < _d->_size + 1), "Deque::insert", "index out of range");
+#endif
+			detach();
+			_d->emplace(before, ard_c::move(value));
+		}
+
+		void remove(int index)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((index >= 0 && index < _d->_size), "Deque::remove", "index out of range");
+#endif
+			detach();
+			_d->remove(index, 1);
+		}
+		void remove(int index, int n)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((index >= 0 && n >= 0 && index + n <= _d->_size), "Deque::remove", "range out of range");
+#endif
+			if (!n) return;
+			detach();
+			_d->remove(index, n);
+		}
+		void removeFirst()
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "Deque::removeFirst", "deque is empty");
+#endif
+			detach();
+			_d->removeFirst();
+		}
+		void removeLast()
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "Deque::removeLast", "deque is empty");
+#endif
+			detach();
+			_d->removeLast();
+		}
+		T take(int index)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((index >= 0 && index < _d->_size), "Deque::take", "index out of range");
+#endif
+			detach();
+			return _d->take(index);
+		}
+		T takeFirst()
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "Deque::takeFirst", "deque is empty");
+#endif
+			detach();
+			return _d->takeFirst();
+		}
+		T takeLast()
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "Deque::takeLast", "deque is empty");
+#endif
+			detach();
+			return _d->takeLast();
+		}
+
+		void clear()
+		{
+			if (R::isShareable && _d->_ref.isShared())
+			{
+				int capacity = _d->_capacity;
+				release();
+				construct_data();
+				_d->reserve(capacity);
+			}
+			else _d->truncate();
+		}
+
+
+		T &operator[](int index)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((index < _d->_size && index >= 0), "Deque::operator[]", "index out of range");
+#endif
+			detach();
+			return _d->at(index);
+		}
+		const T &operator[](int index) const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((index < _d->_size && index >= 0), "Deque::operator[]", "index out of range");
+#endif
+			return _d->at(index);
+		}
+		Deque<T, R, A> &operator=(const Deque<T, R, A> &other)
+		{
+			if (_d != other._d)
+			{
+				if (R::isShareable)
+				{
+					other._d->_ref.ref();
+					release();
+					_d = other._d;
+				}
+				else
+				{
+					release();
+					_d = reinterpret_cast<DequeData<T, R, A>*>(other._d->deep_copy());
+				}
+			}
+			return *this;
+		}
+		bool operator==(const Deque<T, R, A> &other) const { return _d == other._d; }
+		Deque<T, R, A> &operator<<(const T &value) { append(value); return *this; }
+		Deque<T, R, A> &operator<<(T &&value) { append(ard_c::move(value)); return *this; }
+
+
+		inline Iterator begin() { detach(); return Iterator(_d->_d + _d->_begin); }
+		inline ConstIterator begin() const { return ConstIterator(_d->_d + _d->_begin); }
+		inline ConstIterator cbegin() const { return ConstIterator(_d->_d + _d->_begin); }
+		inline ConstIterator constBegin() const { return ConstIterator(_d->_d + _d->_begin); }
+		inline Iterator end() { detach(); return Iterator(_d->_d + _d->_begin + _d->_size); }
+		inline ConstIterator end() const { return ConstIterator(_d->_d + _d->_begin + _d->_size); }
+		inline ConstIterator cend() const { return ConstIterator(_d->_d + _d->_begin + _d->_size); }
+		inline ConstIterator constEnd() const { return ConstIterator(_d->_d + _d->_begin + _d->_size); }
+		inline ConstRange<ConstIterator> constRange() const
+		{
+			ConstRange<ConstIterator> r = { constBegin(), constEnd() };
+			return r;
+		}
+
+#ifdef ARD_C_INSTRUMENT
+		const ContainerStats &stats() const { return _d->_stats; }
+#endif
+
+
+	private:
+		void detach()
+		{
+			if (R::isShareable && _d->_ref.isShared())
+			{
+				DequeData<T, R, A> *d = reinterpret_cast<DequeData<T, R, A>*>(_d->deep_copy());
+#ifdef ARD_C_INSTRUMENT
+				d->_stats.inherit(_d->_stats);
+				globalStats().deque.detached();
+#endif
+				// Un autre propriétaire peut s'être détaché entre isShared() et ici : le dernier
+				// à relâcher l'ancien buffer le détruit.
+				release();
+				_d = d;
+			}
+		}
+
+		void release()
+		{
+			if (!_d->_ref.deref()) DequeData<T, R, A>::destroy(_d);
+		}
+
+		void construct_data()
+		{
+			_d = DequeData<T, R, A>::create();
+		}
+	};
+
+}
+
+#endif // !DEQUE_H
@@ -0,0 +1,176 @@
+#ifndef FLATMAP_H
+#define FLATMAP_H
+
+#include "Vector.h"
+#include "Algorithm.h"
+
+namespace ard_c
+{
+	// FlatMap
+	// Table associative triée par clé ( operator< ), stockée dans deux Vector contigus : un pour les
+	// clés, un pour les valeurs. La recherche dichotomique ne parcourt que les clés, qui tiennent
+	// dans peu de lignes de cache, et la table n'a aucun surcoût par élément.
+	// L'insertion et la suppression décalent les éléments suivants : pour charger une table,
+	// préférer insertSorted() / insertUnsorted() qui fusionnent en un passage.
+	// Les copies partagent leurs données comme Vector ( copy-on-write ).
+	template<typename K, typename V, typename R = ARD_C_DEFAULT_REFCOUNT, typename A = ARD_C_DEFAULT_ALLOCATOR>
+	class FlatMap
+	{
+		Vector<K, R, A> _keys;
+		Vector<V, R, A> _values;
+
+		// Compare deux index de permutation par leur clé.
+		struct IndexLess
+		{
+			const K *keys;
+			bool operator()(int a, int b) const { return keys[a] < keys[b]; }
+		};
+
+	public:
+		FlatMap() {}
+		FlatMap(int alloc) : _keys(alloc), _values(alloc) {}
+
+		int size() const { return _keys.size(); }
+		bool isEmpty() const { return _keys.isEmpty(); }
+		int capacity() const { return _keys.capacity(); }
+		void reserve(int alloc)
+		{
+			_keys.reserve(alloc);
+			_values.reserve(alloc);
+		}
+		void clear()
+		{
+			_keys.clear();
+			_values.clear();
+		}
+
+		// Index de 'key', -1 si elle est absente.
+		int indexOf(const K &key) const { return binarySearch(_keys, key); }
+		bool contains(const K &key) const { return indexOf(key) != -1; }
+		// Valeur associée à 'key', 'defaultValue' si elle est absente.
+		V value(const K &key, const V &defaultValue = V()) const
+		{
+			int i = indexOf(key);
+			return i == -1 ? defaultValue : _values.at(i);
+		}
+		// Pointeur sur la valeur associée à 'key', 0 si elle est absente. Ne détache pas.
+		const V *find(const K &key) const
+		{
+			int i = indexOf(key);
+			return i == -1 ? 0 : _values.constData() + i;
+		}
+
+		const K &keyAt(int index) const { return _keys.at(index); }
+		const V &valueAt(int index) const { return _values.at(index); }
+		V &valueAt(int index) { return _values[index]; }
+		const Vector<K, R, A> &keys() const { return _keys; }
+		const Vector<V, R, A> &values() const { return _values; }
+
+		// Remplace la valeur si 'key' est déjà présente.
+		void insert(const K &key, const V &value)
+		{
+			int i = lowerBound(_keys, key);
+			if (i < _keys.size() && !(key < _keys.at(i))) _values[i] = value;
+			else
+			{
+				_keys.insert(key, i);
+				_values.insert(value, i);
+			}
+		}
+		// Renvoie false si 'key' était absente.
+		bool remove(const K &key)
+		{
+			int i = indexOf(key);
+			if (i == -1) return false;
+			_keys.remove(i);
+			_values.remove(i);
+			return true;
+		}
+		// Valeur associée à 'key', insérée avec V() si elle est absente.
+		V &operator[](const K &key)
+		{
+			int i = lowerBound(_keys, key);
+			if (i == _keys.size() || key < _keys.at(i))
+			{
+				_keys.insert(key, i);
+				_values.insert(V(), i);
+			}
+			return _values[i];
+		}
+
+		// insertSorted
+		// Insère 'n' couples dont les clés sont déjà triées par une fusion en un passage. Pour une
+		// clé présente plusieurs fois, la dernière valeur l'emporte, y compris sur la table.
+		void insertSorted(const K *keys, const V *values, int n)
+		{
+			if (n <= 0) return;
+			const int m = _keys.size();
+			const K *dk = _keys.constData();
+			if (m == 0 || dk[m - 1] < keys[0])
+			{
+				// Clés toutes plus grandes : simple ajout en fin, sans réallocation du contenu.
+				reserve(m + n);
+				for (int j = 0; j < n; ++j)
+				{
+					if (j + 1 < n && !(keys[j] < keys[j + 1])) continue;
+					_keys.append(keys[j]);
+					_values.append(values[j]);
+				}
+				return;
+			}
+
+			const V *dv = _values.constData();
+			Vector<K, R, A> mergedKeys(m + n);
+			Vector<V, R, A> mergedValues(m + n);
+			int i = 0;
+			int j = 0;
+			while (i < m || j < n)
+			{
+				if (j == n || (i < m && dk[i] < keys[j]))
+				{
+					mergedKeys.append(dk[i]);
+					mergedValues.append(dv[i]);
+					++i;
+				}
+				else
+				{
+					while (j + 1 < n && !(keys[j] < keys[j + 1])) ++j;
+					if (i < m && !(keys[j] < dk[i])) ++i;
+					mergedKeys.append(keys[j]);
+					mergedValues.append(values[j]);
+					++j;
+				}
+			}
+			_keys = mergedKeys;
+			_values = mergedValues;
+		}
+		// insertUnsorted
+		// Insère 'n' couples dans un ordre quelconque : une permutation est triée une fois
+		// ( tri stable, la dernière valeur d'une clé l'emporte ) puis fusionnée.
+		void insertUnsorted(const K *keys, const V *values, int n)
+		{
+			if (n <= 0) return;
+			Vector<int, R, A> order(n);
+			for (int j = 0; j < n; ++j) order.append(j);
+			IndexLess less = { keys };
+			stableSort(order, less);
+
+			Vector<K, R, A> sortedKeys(n);
+			Vector<V, R, A> sortedValues(n);
+			for (int j = 0; j < n; ++j)
+			{
+				sortedKeys.append(keys[order.at(j)]);
+				sortedValues.append(values[order.at(j)]);
+			}
+			insertSorted(sortedKeys.constData(), sortedValues.constData(), n);
+		}
+
+		bool operator==(const FlatMap<K, V, R, A> &other) const
+		{
+			return _keys == other._keys && _values == other._values;
+		}
+	};
+}
+
+
+#endif // !FLATMAP_H
@@ -0,0 +1,105 @@
+#ifndef FLATSET_H
+#define FLATSET_H
+
+#include "Vector.h"
+#include "Algorithm.h"
+
+namespace ard_c
+{
+	// FlatSet
+	// Ensemble trié de clés uniques stockées dans un Vector contigu, ordonnées par operator<.
+	// La recherche est une recherche dichotomique, l'insertion et la suppression décalent
+	// les clés suivantes : adapté aux tables lues souvent et modifiées rarement, ou construites
+	// en une fois avec insertSorted() / insertUnsorted().
+	// Les copies partagent leurs données comme Vector ( copy-on-write ).
+	template<typename K, typename R = ARD_C_DEFAULT_REFCOUNT, typename A = ARD_C_DEFAULT_ALLOCATOR>
+	class FlatSet
+	{
+		Vector<K, R, A> _keys;
+
+	public:
+		FlatSet() {}
+		FlatSet(int alloc) : _keys(alloc) {}
+
+		int size() const { return _keys.size(); }
+		bool isEmpty() const { return _keys.isEmpty(); }
+		int capacity() const { return _keys.capacity(); }
+		void reserve(int alloc) { _keys.reserve(alloc); }
+		void clear() { _keys.clear(); }
+
+		// Index de 'key', -1 si elle est absente.
+		int indexOf(const K &key) const { return binarySearch(_keys, key); }
+		bool contains(const K &key) const { return indexOf(key) != -1; }
+		const K &at(int index) const { return _keys.at(index); }
+		const Vector<K, R, A> &keys() const { return _keys; }
+
+		// Renvoie false si 'key' était déjà présente.
+		bool insert(const K &key)
+		{
+			int i = lowerBound(_keys, key);
+			if (i < _keys.size() && !(key < _keys.at(i))) return false;
+			_keys.insert(key, i);
+			return true;
+		}
+		// Renvoie false si 'key' était absente.
+		bool remove(const K &key)
+		{
+			int i = indexOf(key);
+			if (i == -1) return false;
+			_keys.remove(i);
+			return true;
+		}
+
+		// insertSorted
+		// Insère 'n' clés déjà triées ( les doublons sont ignorés ) par une fusion en un passage.
+		void insertSorted(const K *keys, int n)
+		{
+			if (n <= 0) return;
+			const int m = _keys.size();
+			const K *d = _keys.constData();
+			if (m == 0 || d[m - 1] < keys[0])
+			{
+				// Clés toutes plus grandes : simple ajout en fin, sans réallocation du contenu.
+				_keys.reserve(m + n);
+				for (int j = 0; j < n; ++j)
+					if (j == 0 || keys[j - 1] < keys[j]) _keys.append(keys[j]);
+				return;
+			}
+
+			Vector<K, R, A> merged(m + n);
+			int i = 0;
+			int j = 0;
+			while (i < m || j < n)
+			{
+				if (j == n || (i < m && d[i] < keys[j])) merged.append(d[i++]);
+				else
+				{
+					if (i < m && !(keys[j] < d[i])) ++i;
+					merged.append(keys[j++]);
+					while (j < n && !(keys[j - 1] < keys[j])) ++j;
+				}
+			}
+			_keys = merged;
+		}
+		// insertUnsorted
+		// Insère 'n' clés dans un ordre quelconque : elles sont triées une fois puis fusionnées.
+		void insertUnsorted(const K *keys, int n)
+		{
+			if (n <= 0) return;
+			Vector<K, R, A> sorted(n);
+			for (int j = 0; j < n; ++j) sorted.append(keys[j]);
+			sort(sorted);
+			insertSorted(sorted.constData(), n);
+		}
+
+		typename Vector<K, R, A>::ConstIterator begin() const { return _keys.constBegin(); }
+		typename Vector<K, R, A>::ConstIterator end() const { return _keys.constEnd(); }
+		typename Vector<K, R, A>::ConstIterator constBegin() const { return _keys.constBegin(); }
+		typename Vector<K, R, A>::ConstIterator constEnd() const { return _keys.constEnd(); }
+
+		bool operator==(const FlatSet<K, R, A> &other) const { return _keys == other._keys; }
+	};
+}
+
+
+#endif // !FLATSET_H
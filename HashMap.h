@@ -0,0 +1,114 @@
+#ifndef HASHMAP_H
+#define HASHMAP_H
+
+#include "Collection_Hash.h"
+
+namespace ard_c
+{
+	// HashMap
+	// Table associative non triée, en adressage ouvert Robin Hood ( voir HashTable dans
+	// Collection_Hash.h ). Recherche, insertion et suppression en temps constant en moyenne,
+	// sans allocation tant que la capacité suffit ( reserve ).
+	// 'H' calcule le hash d'une clé, Hash<K> est fourni pour les entiers et les flottants.
+	// Une insertion ou une suppression déplace des éléments : les pointeurs et itérateurs
+	// obtenus avant ne sont plus valides.
+	template<typename K, typename V, typename H = Hash<K>, typename A = ARD_C_DEFAULT_ALLOCATOR>
+	class HashMap : public HashTable<K, V, H, A>
+	{
+		typedef HashTable<K, V, H, A> Table;
+
+	public:
+		HashMap() {}
+		HashMap(int alloc) : Table(alloc) {}
+		HashMap(const HashMap<K, V, H, A> &other) : Table(other) {}
+		HashMap(HashMap<K, V, H, A> &&other) : Table(ard_c::move(other)) {}
+
+		HashMap<K, V, H, A> &operator=(const HashMap<K, V, H, A> &other)
+		{
+			Table::assign(other);
+			return *this;
+		}
+		HashMap<K, V, H, A> &operator=(HashMap<K, V, H, A> &&other)
+		{
+			Table::assign(ard_c::move(other));
+			return *this;
+		}
+
+		// Valeur associée à 'key', 'defaultValue' si elle est absente.
+		V value(const K &key, const V &defaultValue = V()) const
+		{
+			int i = Table::find_slot(key);
+			return i == -1 ? defaultValue : Table::_values._v[i];
+		}
+		// Pointeur sur la valeur associée à 'key', 0 si elle est absente.
+		const V *find(const K &key) const
+		{
+			int i = Table::find_slot(key);
+			return i == -1 ? 0 : Table::_values._v + i;
+		}
+		V *find(const K &key)
+		{
+			int i = Table::find_slot(key);
+			return i == -1 ? 0 : Table::_values._v + i;
+		}
+
+		// Remplace la valeur si 'key' est déjà présente.
+		void insert(const K &key, const V &value)
+		{
+			bool inserted;
+			int i = Table::insert_slot(key, inserted, value);
+			if (i != -1 && !inserted) Table::_values._v[i] = value;
+		}
+		void insert(const K &key, V &&value)
+		{
+			bool inserted;
+			int i = Table::insert_slot(key, inserted, ard_c::move(value));
+			if (i != -1 && !inserted) Table::_values._v[i] = ard_c::move(value);
+		}
+		// Retire 'key' et renvoie sa valeur, V() si elle est absente.
+		V take(const K &key)
+		{
+			int i = Table::find_slot(key);
+			if (i == -1) return V();
+			V v(ard_c::move(Table::_values._v[i]));
+			Table::erase_slot(i);
+			return v;
+		}
+		// Valeur associée à 'key', insérée avec V() si elle est absente.
+		// Si la table ne peut pas grandir, il n'y a pas de référence à renvoyer : l'échec est
+		// fatal, que LAUNCH_ASSERT soit défini ou non. insert() puis contains() ne le sont pas.
+		V &operator[](const K &key)
+		{
+			bool inserted;
+			int i = Table::insert_slot(key, inserted);
+			ASSERT_X(i != -1, "HashMap::operator[]", "bad alloc");
+			return Table::_values._v[i];
+		}
+
+
+		class ConstIterator : public Table::ConstIterator
+		{
+			friend class HashMap;
+			ConstIterator(const HashMap *m, int i) : Table::ConstIterator(m, i) {}
+		public:
+			const V &value() const { return static_cast<const HashMap*>(this->_t)->_values._v[this->_i]; }
+		};
+		class Iterator : public Table::ConstIterator
+		{
+			friend class HashMap;
+			Iterator(HashMap *m, int i) : Table::ConstIterator(m, i) {}
+		public:
+			V &value() const { return const_cast<HashMap*>(static_cast<const HashMap*>(this->_t))->_values._v[this->_i]; }
+		};
+
+		Iterator begin() { return Iterator(this, 0); }
+		Iterator end() { return Iterator(this, this->_capacity); }
+		ConstIterator begin() const { return ConstIterator(this, 0); }
+		ConstIterator end() const { return ConstIterator(this, this->_capacity); }
+		ConstIterator constBegin() const { return ConstIterator(this, 0); }
+		ConstIterator constEnd() const { return ConstIterator(this, this->_capacity); }
+	};
+}
+
+
+#endif // !HASHMAP_H
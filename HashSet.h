@@ -0,0 +1,44 @@
+#ifndef HASHSET_H
+#define HASHSET_H
+
+#include "Collection_Hash.h"
+
+namespace ard_c
+{
+	// HashSet
+	// Ensemble de clés uniques non trié, en adressage ouvert Robin Hood ( voir HashTable dans
+	// Collection_Hash.h ). Seules les clés et un octet de métadonnée par case sont stockés.
+	template<typename K, typename H = Hash<K>, typename A = ARD_C_DEFAULT_ALLOCATOR>
+	class HashSet : public HashTable<K, void, H, A>
+	{
+		typedef HashTable<K, void, H, A> Table;
+
+	public:
+		HashSet() {}
+		HashSet(int alloc) : Table(alloc) {}
+		HashSet(const HashSet<K, H, A> &other) : Table(other) {}
+		HashSet(HashSet<K, H, A> &&other) : Table(ard_c::move(other)) {}
+
+		HashSet<K, H, A> &operator=(const HashSet<K, H, A> &other)
+		{
+			Table::assign(other);
+			return *this;
+		}
+		HashSet<K, H, A> &operator=(HashSet<K, H, A> &&other)
+		{
+			Table::assign(ard_c::move(other));
+			return *this;
+		}
+
+		// Renvoie false si 'key' était déjà présente.
+		bool insert(const K &key)
+		{
+			bool inserted;
+			Table::insert_slot(key, inserted);
+			return inserted;
+		}
+	};
+}
+
+
+#endif // !HASHSET_H
@@ -0,0 +1,442 @@
+#ifndef NUMERIC_H
+#define NUMERIC_H
+
+
+#include "Vector.h"
+
+// Largeur en octets des registres vectoriels utilisés par les réductions, choisie à la compilation :
+// 32 avec AVX2, 16 avec SSE2 ou NEON, 0 ( boucles scalaires ) ailleurs, en particulier sur AVR.
+// Les noyaux vectoriels utilisent les extensions vector_size de gcc et clang, que le
+// compilateur traduit dans le jeu d'instructions de la cible. Définir à 0 pour les désactiver.
+#ifndef ARD_C_SIMD_BYTES
+	#if defined(__GNUC__) || defined(__clang__)
+		#if defined(__AVX2__)
+			#define ARD_C_SIMD_BYTES 32
+		#elif defined(__SSE2__) || defined(__ARM_NEON) || defined(__ARM_NEON__)
+			#define ARD_C_SIMD_BYTES 16
+		#else
+			#define ARD_C_SIMD_BYTES 0
+		#endif
+	#else
+		#define ARD_C_SIMD_BYTES 0
+	#endif
+#endif
+
+namespace ard_c
+{
+	// Réductions et scans sur des plages [first, last) et sur les Vector de types arithmétiques
+	// ( is_integral ou is_floating_point ). Ils lisent directement le buffer, sans le contrôle
+	// d'index de at(), et ne détachent pas, sauf prefixSum() qui écrit en place.
+	//
+	// Avec ARD_C_SIMD_BYTES, les sommes de flottants sont faites sur plusieurs accumulateurs :
+	// l'arrondi peut différer de quelques ulp d'une boucle scalaire.
+	//
+	// Les noms minimum() / maximum() évitent les macros min() / max() de Arduino.h.
+
+
+	// sum_type
+	// Type de la somme d'une plage de T : les entiers de moins de 32 bits sont accumulés sur 32 bits
+	// pour qu'une fenêtre de int16_t ne déborde pas, les autres types sur eux mêmes.
+	template<typename T, bool _Narrow = (is_integral<T>::value && sizeof(T) < 4)>
+	struct sum_type
+	{ typedef T type; };
+	template<typename T>
+	struct sum_type<T, true>
+	{ typedef typename conditional<((T)-1 < (T)1), int32_t, uint32_t>::type type; };
+
+	// MinMax
+	// Résultat de minMax().
+	template<typename T>
+	struct MinMax
+	{
+		T min;
+		T max;
+	};
+
+
+	// __is_simd_lane_helper
+	// Types pouvant servir d'élément d'un registre vectoriel ( ni bool, ni long double ).
+	template<typename>
+	struct __is_simd_lane_helper : public false_type
+	{ };
+	_DEFINE_SPEC(__is_simd_lane_helper, char, true)
+	_DEFINE_SPEC(__is_simd_lane_helper, signed char, true)
+	_DEFINE_SPEC(__is_simd_lane_helper, unsigned char, true)
+	_DEFINE_SPEC(__is_simd_lane_helper, short, true)
+	_DEFINE_SPEC(__is_simd_lane_helper, unsigned short, true)
+	_DEFINE_SPEC(__is_simd_lane_helper, int, true)
+	_DEFINE_SPEC(__is_simd_lane_helper, unsigned int, true)
+	_DEFINE_SPEC(__is_simd_lane_helper, long, true)
+	_DEFINE_SPEC(__is_simd_lane_helper, unsigned long, true)
+	_DEFINE_SPEC(__is_simd_lane_helper, long long, true)
+	_DEFINE_SPEC(__is_simd_lane_helper, unsigned long long, true)
+	_DEFINE_SPEC(__is_simd_lane_helper, float, true)
+	_DEFINE_SPEC(__is_simd_lane_helper, double, true)
+
+	template<typename T>
+	struct use_simd
+		: public integral_constant<bool, ARD_C_SIMD_BYTES != 0 && __is_simd_lane_helper<typename remove_cv<T>::type>::value>
+	{ };
+
+
+	// Boucles scalaires, utilisées sur AVR et pour la fin des plages vectorisées.
+
+	template<typename T>
+	inline typename sum_type<T>::type sum_kernel(const T *d, int n, false_type)
+	{
+		typename sum_type<T>::type s = 0;
+		for (int i = 0; i < n; ++i) s += d[i];
+		return s;
+	}
+	template<typename T>
+	inline MinMax<T> minmax_kernel(const T *d, int n, false_type)
+	{
+		MinMax<T> r = { d[0], d[0] };
+		for (int i = 1; i < n; ++i)
+		{
+			if (d[i] < r.min) r.min = d[i];
+			if (r.max < d[i]) r.max = d[i];
+		}
+		return r;
+	}
+	template<typename T>
+	inline T min_kernel(const T *d, int n, false_type)
+	{
+		T r = d[0];
+		for (int i = 1; i < n; ++i) if (d[i] < r) r = d[i];
+		return r;
+	}
+	template<typename T>
+	inline T max_kernel(const T *d, int n, false_type)
+	{
+		T r = d[0];
+		for (int i = 1; i < n; ++i) if (r < d[i]) r = d[i];
+		return r;
+	}
+	template<typename T>
+	inline int index_kernel(const T *d, int n, const T &value, false_type)
+	{
+		for (int i = 0; i < n; ++i) if (d[i] == value) return i;
+		return -1;
+	}
+	template<typename T>
+	inline int count_kernel(const T *d, int n, const T &value, false_type)
+	{
+		int c = 0;
+		for (int i = 0; i < n; ++i) c += d[i] == value;
+		return c;
+	}
+
+
+#if ARD_C_SIMD_BYTES
+
+	// simd
+	// Registre de 'lanes' éléments T. Les chargements ne supposent aucun alignement.
+	template<typename T>
+	struct simd
+	{
+		static const int lanes = ARD_C_SIMD_BYTES / sizeof(T);
+		typedef T vec __attribute__((vector_size(ARD_C_SIMD_BYTES)));
+		typedef unsigned long long words __attribute__((vector_size(ARD_C_SIMD_BYTES)));
+
+		static vec load(const T *p)
+		{
+			vec v;
+			__builtin_memcpy(&v, p, sizeof(v));
+			return v;
+		}
+		static vec splat(T x)
+		{
+			vec v = {};
+			return v + x;
+		}
+		// Vrai si au moins une voie du masque de comparaison 'm' est vraie.
+		template<typename M>
+		static bool any(M m)
+		{
+			words w = (words)m;
+			unsigned long long r = 0;
+			for (int k = 0; k < ARD_C_SIMD_BYTES / 8; ++k) r |= w[k];
+			return r != 0;
+		}
+	};
+
+	// Somme d'un registre 'v' d'éléments T dans 'a', dont les voies sont de la taille de T.
+	template<typename T, typename V>
+	inline void sum_add(V &a, const T *p, false_type)
+	{
+		a += simd<T>::load(p);
+	}
+	// Version pour les entiers de moins de 32 bits : le registre est relu comme des voies de
+	// 32 bits dont chaque morceau est extrait par décalages ( avec extension de signe ) puis
+	// ajouté, sans jamais sortir de la largeur d'un registre.
+	template<typename T, typename V>
+	inline void sum_add(V &a, const T *p, true_type)
+	{
+		typedef uint32_t bits __attribute__((vector_size(ARD_C_SIMD_BYTES)));
+		const int width = 8 * sizeof(T);
+		bits w = (bits)simd<T>::load(p);
+		for (int k = 0; k < 4 / (int)sizeof(T); ++k) a += (V)(w << (32 - width * (k + 1))) >> (32 - width);
+	}
+
+	template<typename T>
+	inline typename sum_type<T>::type sum_kernel(const T *d, int n, true_type)
+	{
+		typedef simd<T> S;
+		typedef typename sum_type<T>::type A;
+		typedef A acc __attribute__((vector_size(ARD_C_SIMD_BYTES)));
+		typedef integral_constant<bool, sizeof(A) != sizeof(T)> widen;
+		const int L = S::lanes;
+
+		// Deux accumulateurs pour ne pas attendre la latence de l'addition à chaque tour.
+		acc a0 = {};
+		acc a1 = {};
+		int i = 0;
+		for (; i + 2 * L <= n; i += 2 * L)
+		{
+			sum_add(a0, d + i, widen());
+			sum_add(a1, d + i + L, widen());
+		}
+		if (i + L <= n)
+		{
+			sum_add(a0, d + i, widen());
+			i += L;
+		}
+		a0 += a1;
+		A s = 0;
+		for (int k = 0; k < (int)(ARD_C_SIMD_BYTES / sizeof(A)); ++k) s += a0[k];
+		for (; i < n; ++i) s += d[i];
+		return s;
+	}
+	template<typename T>
+	inline MinMax<T> minmax_kernel(const T *d, int n, true_type)
+	{
+		typedef simd<T> S;
+		const int L = S::lanes;
+		if (n < L) return minmax_kernel(d, n, false_type());
+
+		typename S::vec lo = S::load(d);
+		typename S::vec hi = lo;
+		int i = L;
+		for (; i + L <= n; i += L)
+		{
+			typename S::vec v = S::load(d + i);
+			lo = v < lo ? v : lo;
+			hi = hi < v ? v : hi;
+		}
+		MinMax<T> r = { lo[0], hi[0] };
+		for (int k = 1; k < L; ++k)
+		{
+			if (lo[k] < r.min) r.min = lo[k];
+			if (r.max < hi[k]) r.max = hi[k];
+		}
+		for (; i < n; ++i)
+		{
+			if (d[i] < r.min) r.min = d[i];
+			if (r.max < d[i]) r.max = d[i];
+		}
+		return r;
+	}
+	template<typename T>
+	inline T min_kernel(const T *d, int n, true_type)
+	{
+		typedef simd<T> S;
+		const int L = S::lanes;
+		if (n < L) return min_kernel(d, n, false_type());
+
+		typename S::vec lo = S::load(d);
+		int i = L;
+		for (; i + L <= n; i += L)
+		{
+			typename S::vec v = S::load(d + i);
+			lo = v < lo ? v : lo;
+		}
+		T r = lo[0];
+		for (int k = 1; k < L; ++k) if (lo[k] < r) r = lo[k];
+		for (; i < n; ++i) if (d[i] < r) r = d[i];
+		return r;
+	}
+	template<typename T>
+	inline T max_kernel(const T *d, int n, true_type)
+	{
+		typedef simd<T> S;
+		const int L = S::lanes;
+		if (n < L) return max_kernel(d, n, false_type());
+
+		typename S::vec hi = S::load(d);
+		int i = L;
+		for (; i + L <= n; i += L)
+		{
+			typename S::vec v = S::load(d + i);
+			hi = hi < v ? v : hi;
+		}
+		T r = hi[0];
+		for (int k = 1; k < L; ++k) if (r < hi[k]) r = hi[k];
+		for (; i < n; ++i) if (r < d[i]) r = d[i];
+		return r;
+	}
+	template<typename T>
+	inline int index_kernel(const T *d, int n, const T &value, true_type)
+	{
+		typedef simd<T> S;
+		const int L = S::lanes;
+		const typename S::vec s = S::splat(value);
+		int i = 0;
+		// Recherche du premier bloc contenant la valeur, puis de sa position dans le bloc.
+		while (i + L <= n && !S::any(S::load(d + i) == s)) i += L;
+		for (; i < n; ++i) if (d[i] == value) return i;
+		return -1;
+	}
+	template<typename T>
+	inline int count_kernel(const T *d, int n, const T &value, true_type)
+	{
+		typedef simd<T> S;
+		typedef decltype(S::load(d) == S::load(d)) mask;
+		const int L = S::lanes;
+		const typename S::vec s = S::splat(value);
+
+		// Une voie vraie vaut -1 : les compteurs par voie sont vidés tous les 127 blocs
+		// pour ne pas déborder sur les types 8 bits.
+		int c = 0;
+		int i = 0;
+		while (i + L <= n)
+		{
+			mask m = {};
+			for (int b = 0; b < 127 && i + L <= n; ++b, i += L) m -= (S::load(d + i) == s);
+			for (int k = 0; k < L; ++k) c += (int)m[k];
+		}
+		for (; i < n; ++i) c += d[i] == value;
+		return c;
+	}
+
+#endif	// ARD_C_SIMD_BYTES
+
+
+	// sum
+	// Somme des éléments, 0 pour une plage vide ( voir sum_type ).
+	template<typename T>
+	inline typename sum_type<T>::type sum(const T *first, const T *last)
+	{
+		static_assert(is_atomic<T>::value, "ard_c::sum needs an arithmetic type");
+		return sum_kernel(first, (int)(last - first), use_simd<T>());
+	}
+
+	// minimum / maximum / minMax
+	// Plus petit et plus grand élément d'une plage non vide.
+	template<typename T>
+	inline T minimum(const T *first, const T *last)
+	{
+		static_assert(is_atomic<T>::value, "ard_c::minimum needs an arithmetic type");
+#ifdef LAUNCH_ASSERT
+		ASSERT_X(first < last, "ard_c::minimum", "empty range");
+#endif
+		return min_kernel(first, (int)(last - first), use_simd<T>());
+	}
+	template<typename T>
+	inline T maximum(const T *first, const T *last)
+	{
+		static_assert(is_atomic<T>::value, "ard_c::maximum needs an arithmetic type");
+#ifdef LAUNCH_ASSERT
+		ASSERT_X(first < last, "ard_c::maximum", "empty range");
+#endif
+		return max_kernel(first, (int)(last - first), use_simd<T>());
+	}
+	template<typename T>
+	inline MinMax<T> minMax(const T *first, const T *last)
+	{
+		static_assert(is_atomic<T>::value, "ard_c::minMax needs an arithmetic type");
+#ifdef LAUNCH_ASSERT
+		ASSERT_X(first < last, "ard_c::minMax", "empty range");
+#endif
+		return minmax_kernel(first, (int)(last - first), use_simd<T>());
+	}
+
+	// indexOf / contains / count
+	// Position de la première occurrence de 'value' ( -1 si absente ), présence et nombre d'occurrences.
+	template<typename T>
+	inline int indexOf(const T *first, const T *last, const T &value)
+	{
+		static_assert(is_atomic<T>::value, "ard_c::indexOf needs an arithmetic type");
+		return index_kernel(first, (int)(last - first), value, use_simd<T>());
+	}
+	template<typename T>
+	inline bool contains(const T *first, const T *last, const T &value)
+	{
+		return indexOf(first, last, value) != -1;
+	}
+	template<typename T>
+	inline int count(const T *first, const T *last, const T &value)
+	{
+		static_assert(is_atomic<T>::value, "ard_c::count needs an arithmetic type");
+		return count_kernel(first, (int)(last - first), value, use_simd<T>());
+	}
+
+	// prefixSum
+	// Somme cumulée inclusive : out[i] = first[0] + ... + first[i]. 'out' peut être 'first'
+	// ( en place ) ou un buffer d'un type plus large. Chaque élément dépend du précédent,
+	// la boucle reste scalaire.
+	template<typename T, typename U>
+	inline void prefixSum(const T *first, const T *last, U *out)
+	{
+		static_assert(is_atomic<T>::value && is_atomic<U>::value, "ard_c::prefixSum needs an arithmetic type");
+		const int n = (int)(last - first);
+		U s = 0;
+		for (int i = 0; i < n; ++i)
+		{
+			s += first[i];
+			out[i] = s;
+		}
+	}
+	template<typename T>
+	inline void prefixSum(T *first, T *last)
+	{
+		prefixSum(const_cast<const T*>(first), const_cast<const T*>(last), first);
+	}
+
+
+	// Versions Vector.
+
+	template<typename T, typename R, typename A>
+	inline typename sum_type<T>::type sum(const Vector<T, R, A> &v)
+	{
+		return sum(v.constData(), v.constData() + v.size());
+	}
+	template<typename T, typename R, typename A>
+	inline T minimum(const Vector<T, R, A> &v)
+	{
+		return minimum(v.constData(), v.constData() + v.size());
+	}
+	template<typename T, typename R, typename A>
+	inline T maximum(const Vector<T, R, A> &v)
+	{
+		return maximum(v.constData(), v.constData() + v.size());
+	}
+	template<typename T, typename R, typename A>
+	inline MinMax<T> minMax(const Vector<T, R, A> &v)
+	{
+		return minMax(v.constData(), v.constData() + v.size());
+	}
+	template<typename T, typename R, typename A>
+	inline int indexOf(const Vector<T, R, A> &v, const T &value)
+	{
+		return indexOf(v.constData(), v.constData() + v.size(), value);
+	}
+	template<typename T, typename R, typename A>
+	inline bool contains(const Vector<T, R, A> &v, const T &value)
+	{
+		return contains(v.constData(), v.constData() + v.size(), value);
+	}
+	template<typename T, typename R, typename A>
+	inline int count(const Vector<T, R, A> &v, const T &value)
+	{
+		return count(v.constData(), v.constData() + v.size(), value);
+	}
+	template<typename T, typename R, typename A>
+	inline void prefixSum(Vector<T, R, A> &v)
+	{
+		T *d = v.data();
+		prefixSum(d, d + v.size());
+	}
+}
+
+#endif // !NUMERIC_H
@@ -0,0 +1,368 @@
+#ifndef PRIORITYQUEUE_H
+#define PRIORITYQUEUE_H
+
+#include "Vector.h"
+#include "Algorithm.h"
+
+namespace ard_c
+{
+	// Tas d-aire rangé dans un tableau : les enfants de i sont D * i + 1 ... D * i + D.
+	// 'moved( v, i )' est appelé à chaque fois qu'un élément est posé à l'index i.
+	struct __heap_no_track
+	{
+		template<typename T>
+		void operator()(const T &, int) const {}
+	};
+
+	template<int D, typename T, typename C, typename M>
+	inline void heap_sift_up(T *h, int i, C cmp, M moved)
+	{
+		T v(ard_c::move(h[i]));
+		while (i > 0)
+		{
+			int p = (i - 1) / D;
+			if (!cmp(v, h[p])) break;
+			h[i] = ard_c::move(h[p]);
+			moved(h[i], i);
+			i = p;
+		}
+		h[i] = ard_c::move(v);
+		moved(h[i], i);
+	}
+
+	// Meilleur des enfants c ... c + D - 1 ( c < n ). Un nœud complet a un nombre
+	// d'enfants constant, que le compilateur déroule.
+	template<int D, typename T, typename C>
+	inline int heap_best_child(const T *h, int c, int n, C cmp)
+	{
+		int best = c;
+		if (n - c >= D)
+		{
+			for (int k = 1; k < D; ++k)
+				if (cmp(h[c + k], h[best])) best = c + k;
+		}
+		else
+		{
+			for (int k = c + 1; k < n; ++k)
+				if (cmp(h[k], h[best])) best = k;
+		}
+		return best;
+	}
+
+	template<int D, typename T, typename C, typename M>
+	inline void heap_sift_down(T *h, int i, int n, C cmp, M moved)
+	{
+		T v(ard_c::move(h[i]));
+		for (;;)
+		{
+			int c = D * i + 1;
+			if (c >= n) break;
+			int best = heap_best_child<D>(h, c, n, cmp);
+			if (!cmp(h[best], v)) break;
+			h[i] = ard_c::move(h[best]);
+			moved(h[i], i);
+			i = best;
+		}
+		h[i] = ard_c::move(v);
+		moved(h[i], i);
+	}
+
+	// Remplacement de la racine, déjà déplacée hors du tas : le trou descend jusqu'à une feuille
+	// en suivant le meilleur enfant, puis 'v' y est posé et remonte. Une valeur qui vient du bas
+	// du tas ( dernier élément, minuterie réarmée ) remonte rarement loin : une comparaison de
+	// moins par niveau qu'un heap_sift_down depuis la racine.
+	template<int D, typename T, typename C, typename M>
+	inline void heap_replace_root(T *h, int n, T &&v, C cmp, M moved)
+	{
+		int i = 0;
+		for (;;)
+		{
+			int c = D * i + 1;
+			if (c >= n) break;
+			int best = heap_best_child<D>(h, c, n, cmp);
+			h[i] = ard_c::move(h[best]);
+			moved(h[i], i);
+			i = best;
+		}
+		h[i] = ard_c::move(v);
+		heap_sift_up<D>(h, i, cmp, moved);
+	}
+
+	// Construction ascendante en O( n ).
+	template<int D, typename T, typename C, typename M>
+	inline void heap_make(T *h, int n, C cmp, M moved)
+	{
+		for (int i = (n - 2) / D; i >= 0 && n > 1; --i) heap_sift_down<D>(h, i, n, cmp, moved);
+		if (n == 1) moved(h[0], 0);
+	}
+
+
+	// PriorityQueue
+	// File de priorité en tas d-aire stocké dans un Vector. top() est le premier élément selon
+	// 'C' : avec Less<T> ( par défaut ) c'est le plus petit, ce qui convient à une échéance de
+	// minuterie. push() et pop() sont en O( log n ), au lieu du décalage en O( n ) d'une
+	// insertion dans un Vector trié.
+	// D = 2 donne un tas binaire ; D = 4 divise la hauteur par deux et garde les quatre enfants
+	// sur la même ligne de cache, ce qui rend pop() plus rapide sur les grandes files.
+	// Les copies partagent leurs données comme Vector ( copy-on-write ).
+	template<typename T, typename C = Less<T>, int D = 2, typename R = ARD_C_DEFAULT_REFCOUNT, typename A = ARD_C_DEFAULT_ALLOCATOR>
+	class PriorityQueue
+	{
+		static_assert(D >= 2, "PriorityQueue: arity must be at least 2");
+
+		Vector<T, R, A> _heap;
+		C _cmp;
+
+	public:
+		PriorityQueue(C cmp = C()) : _cmp(cmp) {}
+		PriorityQueue(int alloc, C cmp = C()) : _heap(alloc), _cmp(cmp) {}
+		// Construit le tas en O( n ) à partir de valeurs dans un ordre quelconque.
+		PriorityQueue(const Vector<T, R, A> &values, C cmp = C()) : _heap(values), _cmp(cmp) { heapify(); }
+
+		int size() const { return _heap.size(); }
+		bool isEmpty() const { return _heap.isEmpty(); }
+		int capacity() const { return _heap.capacity(); }
+		void reserve(int alloc) { _heap.reserve(alloc); }
+		void clear() { _heap.clear(); }
+
+		const T &top() const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "PriorityQueue::top", "queue is empty");
+#endif
+			return _heap.at(0);
+		}
+		void push(const T &value)
+		{
+			_heap.append(value);
+			heap_sift_up<D>(_heap.data(), _heap.size() - 1, _cmp, __heap_no_track());
+		}
+		void push(T &&value)
+		{
+			_heap.append(ard_c::move(value));
+			heap_sift_up<D>(_heap.data(), _heap.size() - 1, _cmp, __heap_no_track());
+		}
+		T pop()
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "PriorityQueue::pop", "queue is empty");
+#endif
+			T *h = _heap.data();
+			const int n = _heap.size() - 1;
+			T value(ard_c::move(h[0]));
+			if (n > 0) heap_replace_root<D>(h, n, ard_c::move(h[n]), _cmp, __heap_no_track());
+			_heap.removeLast();
+			return value;
+		}
+		// Remplace top() par 'value' et renvoie l'ancien : équivaut à pop() suivi de push( value ),
+		// en une seule descente. C'est le cas d'une minuterie périodique que l'on réarme.
+		T replaceTop(const T &value)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "PriorityQueue::replaceTop", "queue is empty");
+#endif
+			T *h = _heap.data();
+			T old(ard_c::move(h[0]));
+			heap_replace_root<D>(h, _heap.size(), T(value), _cmp, __heap_no_track());
+			return old;
+		}
+
+		// Remplace le contenu par 'values' ( dans un ordre quelconque ), en O( n ).
+		void assign(const Vector<T, R, A> &values)
+		{
+			_heap = values;
+			heapify();
+		}
+		// Ajoute 'n' valeurs. Au-delà d'un quart de la taille, reconstruire le tas en une fois
+		// est moins coûteux que n remontées.
+		void push(const T *values, int n)
+		{
+			if (n <= 0) return;
+			const int m = _heap.size();
+			_heap.reserve(m + n);
+			for (int j = 0; j < n; ++j) _heap.append(values[j]);
+			if (n > m / 4) heapify();
+			else
+			{
+				T *h = _heap.data();
+				for (int j = m; j < m + n; ++j) heap_sift_up<D>(h, j, _cmp, __heap_no_track());
+			}
+		}
+		// Éléments dans l'ordre du tas ( seul le premier est ordonné ).
+		const Vector<T, R, A> &values() const { return _heap; }
+
+	private:
+		void heapify() { heap_make<D>(_heap.data(), _heap.size(), _cmp, __heap_no_track()); }
+	};
+
+
+	// IndexedPriorityQueue
+	// PriorityQueue dont chaque élément est repéré par un Handle stable tant qu'il est dans la
+	// file : update() / decreaseKey() changent sa priorité en O( log n ) et remove() le retire,
+	// sans recherche. Une table handle -> index dans le tas est tenue à jour à chaque
+	// déplacement. Les handles libérés sont réutilisés.
+	template<typename T, typename C = Less<T>, int D = 2, typename R = ARD_C_DEFAULT_REFCOUNT, typename A = ARD_C_DEFAULT_ALLOCATOR>
+	class IndexedPriorityQueue
+	{
+		static_assert(D >= 2, "IndexedPriorityQueue: arity must be at least 2");
+
+	public:
+		typedef int Handle;
+
+	private:
+		struct Node
+		{
+			T value;
+			Handle handle;
+		};
+		struct NodeLess
+		{
+			C cmp;
+			bool operator()(const Node &a, const Node &b) const { return cmp(a.value, b.value); }
+		};
+		struct Track
+		{
+			int *pos;
+			void operator()(const Node &n, int i) const { pos[n.handle] = i; }
+		};
+
+		Vector<Node, R, A> _heap;
+		// Index dans le tas de chaque handle, -1 s'il est libre.
+		Vector<int, R, A> _pos;
+		Vector<Handle, R, A> _free;
+		NodeLess _less;
+
+		Track track() { Track t = { _pos.data() }; return t; }
+		int index(Handle handle) const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(contains(handle), "IndexedPriorityQueue", "invalid handle");
+#endif
+			return _pos.at(handle);
+		}
+		// Retire l'élément d'index i en le remplaçant par le dernier.
+		T take(int i)
+		{
+			Node *h = _heap.data();
+			const int n = _heap.size() - 1;
+			_pos[h[i].handle] = -1;
+			_free.append(h[i].handle);
+			T value(ard_c::move(h[i].value));
+			if (i < n)
+			{
+				h[i] = ard_c::move(h[n]);
+				_heap.removeLast();
+				fix(i);
+			}
+			else _heap.removeLast();
+			return value;
+		}
+		void fix(int i)
+		{
+			Node *h = _heap.data();
+			if (i > 0 && _less(h[i], h[(i - 1) / D])) heap_sift_up<D>(h, i, _less, track());
+			else heap_sift_down<D>(h, i, _heap.size(), _less, track());
+		}
+
+	public:
+		IndexedPriorityQueue(C cmp = C()) { _less.cmp = cmp; }
+		IndexedPriorityQueue(int alloc, C cmp = C()) : _heap(alloc), _pos(alloc) { _less.cmp = cmp; }
+
+		int size() const { return _heap.size(); }
+		bool isEmpty() const { return _heap.isEmpty(); }
+		void reserve(int alloc)
+		{
+			_heap.reserve(alloc);
+			_pos.reserve(alloc);
+		}
+		void clear()
+		{
+			_heap.clear();
+			_pos.clear();
+			_free.clear();
+		}
+
+		bool contains(Handle handle) const { return handle >= 0 && handle < _pos.size() && _pos.at(handle) != -1; }
+		const T &value(Handle handle) const { return _heap.at(index(handle)).value; }
+
+		const T &top() const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "IndexedPriorityQueue::top", "queue is empty");
+#endif
+			return _heap.at(0).value;
+		}
+		Handle topHandle() const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "IndexedPriorityQueue::topHandle", "queue is empty");
+#endif
+			return _heap.at(0).handle;
+		}
+
+		Handle push(const T &value)
+		{
+			Handle handle;
+			if (_free.isEmpty())
+			{
+				handle = _pos.size();
+				_pos.append(-1);
+			}
+			else handle = _free.takeLast();
+			Node n = { value, handle };
+			_heap.append(ard_c::move(n));
+			heap_sift_up<D>(_heap.data(), _heap.size() - 1, _less, track());
+			return handle;
+		}
+		// Retire le premier élément ; son handle devient invalide.
+		T pop()
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "IndexedPriorityQueue::pop", "queue is empty");
+#endif
+			Node *h = _heap.data();
+			_pos[h[0].handle] = -1;
+			_free.append(h[0].handle);
+			const int n = _heap.size() - 1;
+			T value(ard_c::move(h[0].value));
+			if (n > 0) heap_replace_root<D>(h, n, ard_c::move(h[n]), _less, track());
+			_heap.removeLast();
+			return value;
+		}
+		// Remplace la valeur de topHandle() par 'value', qui garde son handle, et renvoie
+		// l'ancienne : déclencher puis réarmer une minuterie en une seule descente.
+		T replaceTop(const T &value)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "IndexedPriorityQueue::replaceTop", "queue is empty");
+#endif
+			Node *h = _heap.data();
+			Node n = { value, h[0].handle };
+			T old(ard_c::move(h[0].value));
+			heap_replace_root<D>(h, _heap.size(), ard_c::move(n), _less, track());
+			return old;
+		}
+		T remove(Handle handle) { return take(index(handle)); }
+
+		// Change la priorité de 'handle', dans un sens ou dans l'autre.
+		void update(Handle handle, const T &value)
+		{
+			int i = index(handle);
+			_heap[i].value = value;
+			fix(i);
+		}
+		// 'value' ne doit pas passer après la valeur actuelle : seule une remontée est faite.
+		void decreaseKey(Handle handle, const T &value)
+		{
+			int i = index(handle);
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!_less.cmp(_heap.at(i).value, value), "IndexedPriorityQueue::decreaseKey", "key would increase");
+#endif
+			_heap[i].value = value;
+			heap_sift_up<D>(_heap.data(), i, _less, track());
+		}
+	};
+}
+
+
+#endif // !PRIORITYQUEUE_H
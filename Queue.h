@@ -3,180 +3,289 @@
 #define QUEUE_H
 
 #include "RefCount.h"
+#include "Vector.h"
 #include "Collection_Tool.h"
 #include "Collection_TypeTrait.h"
+#include "Collection_Relocation.h"
+#include "Collection_Allocator.h"
+#include "Collection_Instrument.h"
 
 namespace ard_c
 {
 
-	template<typename T>
+	template<typename T, typename R = ARD_C_DEFAULT_REFCOUNT, typename A = ARD_C_DEFAULT_ALLOCATOR>
 	struct QueueData
 	{
-		struct Node
-		{
-			T *_d;
-			Node *_p;
-			Node *_n;
-		};
-
-		RefCount _ref;
+		R _ref;
 		int _size;
-		Node *_first;
-		Node *_last;
-		Node *_end;
-
-		static Node *get_end_ptr() { return new Node(); }
+		int _capacity;
+		int _head;
+		T *_d;
+#ifdef ARD_C_INSTRUMENT
+		ContainerStats _stats;
+#endif
 
 
-		void enqueue(const T &v)
+		static QueueData<T, R, A> *create()
 		{
-			Node *e = construct_node(v);
-			if (!_first) _first = e;
-			if (_last)
-			{
-				_last->_n = e;
-				e->_p = _last;
-			}
-			_last = e;
-			_last->_n = _end;
-			_end->_p = e;
-			++_size;
+			void *p = A::allocate(sizeof(QueueData<T, R, A>));
+			ASSERT_X(p, "QueueData::create", "bad alloc");
+			QueueData<T, R, A> *d = new (p) QueueData<T, R, A>();
+			d->_ref = R::init_ref();
+			d->_size = 0;
+			d->_capacity = 0;
+			d->_head = 0;
+			d->_d = 0;
+			ARD_C_STATS(d, queue, allocated(sizeof(QueueData<T, R, A>)));
+			return d;
 		}
-		T dequeue()
+		static void destroy(QueueData<T, R, A> *d)
 		{
-			Node *d = _first;
-			_first = _first->_n;
-			--_size;
-			if (!_size) _end->_p = 0;
-			T r = *d->_d;
-			free(d);
-			return r;
+			d->clear();
+			ARD_C_STATS(d, queue, freed(sizeof(QueueData<T, R, A>)));
+			d->~QueueData<T, R, A>();
+			A::deallocate(d, sizeof(QueueData<T, R, A>));
 		}
 
-		T &at(int i)
+
+		int index(int i) const { return (_head + i) & (_capacity - 1); }
+
+		void grow()
 		{
-			if (i == 0) return *_first->_d;
-			int n = 0;
-			Node *c = _first;
-			while (n < i)
+			if (_size < _capacity) return;
+			int newCap = (int)nextPowerOfTwo(_capacity);
+			T *d = reallocate<A>(_d, _size, _capacity, newCap);
+			if (!d) failed_alloc_purge();
+			if (_capacity) ARD_C_STATS(this, queue, reallocated(sizeof(T) * _capacity, sizeof(T) * newCap));
+			else ARD_C_STATS(this, queue, allocated(sizeof(T) * newCap));
+			_d = d;
+			// Le buffer est plein : les index [0, _head) sont la fin logique de la file,
+			// on les déplace juste après l'ancienne capacité pour la rendre contiguë.
+			relocate_n(_d + _capacity, _d, _head);
+			ARD_C_STATS(this, queue, moved(sizeof(T) * _head));
+			_capacity = newCap;
+		}
+		// Déplace les éléments dans un nouveau buffer de 'capacity' éléments ( puissance de 2,
+		// au moins _size ), la file y est rendue contiguë à partir de l'index 0.
+		void setCapacity(int capacity)
+		{
+			T *d = 0;
+			if (capacity)
+			{
+				d = reinterpret_cast<T*>(A::allocate(sizeof(T) * capacity));
+				if (!d) failed_alloc_purge();
+				if (_size)
+				{
+					int first = _capacity - _head;
+					if (first > _size) first = _size;
+					relocate_n(d, _d + _head, first);
+					relocate_n(d + first, _d, _size - first);
+				}
+			}
+			A::deallocate(_d, sizeof(T) * _capacity);
+			if (capacity && _capacity)
 			{
-				ASSERT_X(c->_n, "QueueData::at", "index out of range");
-				c = c->_n;
-				++n;
+				ARD_C_STATS(this, queue, reallocated(sizeof(T) * _capacity, sizeof(T) * capacity));
+				ARD_C_STATS(this, queue, moved(sizeof(T) * _size));
 			}
-			return *c->_d;
+			else if (capacity) ARD_C_STATS(this, queue, allocated(sizeof(T) * capacity));
+			else ARD_C_STATS(this, queue, freed(sizeof(T) * _capacity));
+			_d = d;
+			_capacity = capacity;
+			_head = 0;
+		}
+		void reserve(int n)
+		{
+			if (n > _capacity) setCapacity((int)nextPowerOfTwo(n - 1));
 		}
-		const T &at(int i) const
+		void shrink()
 		{
-			return at(i);
+			int capacity = _size ? (int)nextPowerOfTwo(_size - 1) : 0;
+			if (capacity < _capacity) setCapacity(capacity);
 		}
 
-		Node *construct_node(const T &v)
+		void failed_alloc_purge()
 		{
-			Node *n = new Node();
-			if (TypeTrait<T>::isAtomic)
-			{
-				::memcpy(n->_d, &v, sizeof(T));
-			}
-			else
+			A::deallocate(_d, sizeof(T) * _capacity);
+			ARD_C_STATS(this, queue, freed(sizeof(T) * _capacity));
+			_d = 0;
+			_capacity = 0;
+			_size = 0;
+			_head = 0;
+			ASSERT_X(false, "QueueData::grow", "bad alloc");
+		}
+
+
+		template<typename... Args>
+		void emplaceEnqueue(Args&&... args)
+		{
+			if (_size == _capacity)
 			{
-				n->_d = new T(v);
+				// Les arguments peuvent référencer un élément de la file : on construit
+				// la valeur avant que la réallocation ne les invalide.
+				T t(ard_c::forward<Args>(args)...);
+				grow();
+				new (_d + index(_size)) T(ard_c::move(t));
 			}
+			else new (_d + index(_size)) T(ard_c::forward<Args>(args)...);
+			++_size;
+		}
+		void enqueue(const T &v) { emplaceEnqueue(v); }
+		void enqueue(T &&v) { emplaceEnqueue(ard_c::move(v)); }
+		void enqueue(const T *range, int n)
+		{
+			if (_size + n > _capacity) setCapacity((int)nextPowerOfTwo(_size + n - 1));
+			int tail = index(_size);
+			int first = _capacity - tail;
+			if (first > n) first = n;
+			copy_construct_n(_d + tail, range, first);
+			copy_construct_n(_d, range + first, n - first);
+			_size += n;
+		}
+		int dequeue(T *out, int n)
+		{
+			if (n > _size) n = _size;
+			int first = _capacity - _head;
+			if (first > n) first = n;
+			move_out_n(out, _d + _head, first);
+			move_out_n(out + first, _d, n - first);
+			_head = (_head + n) & (_capacity - 1);
+			_size -= n;
+			if (!_size) _head = 0;
 			return n;
 		}
-		Node *copy_node(Node *o)
+		int peek(T *out, int n) const
 		{
-			Node *n = new Node();
-			if (TypeTrait<T>::isAtomic)
-			{
-				::memcpy(n->_d, o->_d, sizeof(T));
-			}
-			else
-			{
-				n->_d = new T(*o->_d);
-			}
+			if (n > _size) n = _size;
+			int first = _capacity - _head;
+			if (first > n) first = n;
+			copy_assign_n(out, _d + _head, first);
+			copy_assign_n(out + first, _d, n - first);
 			return n;
 		}
+		T dequeue()
+		{
+			T *d = _d + _head;
+			T r(ard_c::move(*d));
+			d->~T();
+			_head = (_head + 1) & (_capacity - 1);
+			--_size;
+			if (!_size) _head = 0;
+			return r;
+		}
+
+		T &at(int i) { return _d[index(i)]; }
+		const T &at(int i) const { return _d[index(i)]; }
+
 		void clear()
 		{
-			Node *l = _last;
-			Node *p = _last->_p;
-			while (p)
-			{
-				free(l);
-				Node *b = p->_p;
-				l = p;
-				p = b;
-			}
-			free(_end);
+			int first = _capacity - _head;
+			if (first > _size) first = _size;
+			destroy_n(_d + _head, first);
+			destroy_n(_d, _size - first);
+			A::deallocate(_d, sizeof(T) * _capacity);
+			ARD_C_STATS(this, queue, freed(sizeof(T) * _capacity));
 		}
 		void *deep_copy()
 		{
-			QueueData<T> *d = new QueueData<T>();
-			d->_end = get_end_ptr();
-			d->_ref = RefCount::init_ref();
-			d->_size = _size;
-			if (_first)
-			{
-				Node *n = _first;
-				Node *c = copy_node(n);
-				d->_first = c;
-				while (n->_n != _end)
-				{
-					n = n->_n;
-					Node *c2 = copy_node(n);
-					c->_n = c2;
-					c2->_p = c;
-					c = c2;
-				}
-				d->_last = c;
-				d->_last->_n = d->_end;
-				d->_end->_p = d->_last;
-			}
-			
-			return d;
+			QueueData<T, R, A> *dest = create();
+			if (!_capacity) return dest;
+
+			T *c = reinterpret_cast<T*>(A::allocate(sizeof(T) * _capacity));
+			if (!c) failed_alloc_purge();
+			ARD_C_STATS(dest, queue, allocated(sizeof(T) * _capacity));
+			dest->_d = c;
+			dest->_capacity = _capacity;
+			dest->_size = _size;
+			int first = _capacity - _head;
+			if (first > _size) first = _size;
+			copy_construct_n(c, _d + _head, first);
+			copy_construct_n(c + first, _d, _size - first);
+			return dest;
 		}
 	};
 
 
 
-	template<typename T>
+	template<typename T, typename R = ARD_C_DEFAULT_REFCOUNT, typename A = ARD_C_DEFAULT_ALLOCATOR>
 	class Queue
 	{
-		QueueData<T> *_d;
+		QueueData<T, R, A> *_d;
 
 	public:
 		Queue()
 		{
 			construct_data();
 		}
-		Queue(const Queue<T> &other)
+		Queue(const Queue<T, R, A> &other)
 		{
-			_d = other._d;
-			_d->_ref.ref();
+			if (R::isShareable)
+			{
+				_d = other._d;
+				_d->_ref.ref();
+			}
+			else _d = reinterpret_cast<QueueData<T, R, A>*>(other._d->deep_copy());
 		}
 		~Queue()
 		{
-			if (!_d->_ref.deref())
-			{
-				_d->clear();
-				free(_d);
-			}
+			release();
 		}
 
 		int size() const { return _d->_size; }
 		bool isEmpty() const { return _d->_size == 0; }
+		int capacity() const { return _d->_capacity; }
 		const T &at(int index) const
 		{
 			ASSERT_X(index < _d->_size, "Queue::at", "index out of range");
 			return _d->at(index);
 		}
 
+		// Réserve la place pour 'alloc' éléments ( arrondi à la puissance de 2 supérieure ) :
+		// tant que la taille ne la dépasse pas, enqueue et dequeue ne font aucune allocation.
+		void reserve(int alloc)
+		{
+			ASSERT_X(alloc >= 0, "Queue::reserve", "allocation must be a positive integer");
+			detach();
+			_d->reserve(alloc);
+		}
+		// Rend la capacité inutilisée : ramène le buffer à la plus petite puissance de 2
+		// contenant la file, ou le libère si elle est vide.
+		void shrink()
+		{
+			detach();
+			_d->shrink();
+		}
+
 		void enqueue(const T &value)
 		{
 			detach();
 			_d->enqueue(value);
 		}
+		void enqueue(T &&value)
+		{
+			detach();
+			_d->enqueue(ard_c::move(value));
+		}
+		// Ajoute les 'n' éléments de 'range' en un seul detach() et au plus une allocation.
+		// 'range' ne doit pas pointer dans la file.
+		void enqueue(const T *range, int n)
+		{
+			ASSERT_X(n >= 0, "Queue::enqueue", "count must be a positive integer");
+			if (!n) return;
+			detach();
+			_d->enqueue(range, n);
+		}
+		template<typename R2, typename A2>
+		void enqueue(const Vector<T, R2, A2> &values)
+		{
+			enqueue(values.constData(), values.size());
+		}
+		template<typename... Args>
+		void emplaceEnqueue(Args&&... args)
+		{
+			detach();
+			_d->emplaceEnqueue(ard_c::forward<Args>(args)...);
+		}
 
 		T dequeue()
 		{
@@ -184,11 +293,44 @@ namespace ard_c
 			detach();
 			return _d->dequeue();
 		}
+		// Retire au plus 'n' éléments de la tête de la file et les affecte à 'out'.
+		// Renvoie le nombre d'éléments réellement retirés.
+		int dequeue(T *out, int n)
+		{
+			ASSERT_X(n >= 0, "Queue::dequeue", "count must be a positive integer");
+			if (!n || isEmpty()) return 0;
+			detach();
+			return _d->dequeue(out, n);
+		}
+		// Copie dans 'out' au plus 'n' éléments de la tête de la file, sans les retirer.
+		int peek(T *out, int n) const
+		{
+			ASSERT_X(n >= 0, "Queue::peek", "count must be a positive integer");
+			return _d->peek(out, n);
+		}
 
-		T &first() { detach(); return *_d->_first; }
-		const T &first() const { return *_d->_first; }
-		T &last() { detach(); return *_d->_last; }
-		const T &last() const { return *_d->_last; }
+		T &first()
+		{
+			ASSERT_X(!isEmpty(), "Queue::first", "Queue is empty");
+			detach();
+			return _d->at(0);
+		}
+		const T &first() const
+		{
+			ASSERT_X(!isEmpty(), "Queue::first", "Queue is empty");
+			return _d->at(0);
+		}
+		T &last()
+		{
+			ASSERT_X(!isEmpty(), "Queue::last", "Queue is empty");
+			detach();
+			return _d->at(_d->_size - 1);
+		}
+		const T &last() const
+		{
+			ASSERT_X(!isEmpty(), "Queue::last", "Queue is empty");
+			return _d->at(_d->_size - 1);
+		}
 
 
 		T &operator[](int index)
@@ -202,8 +344,25 @@ namespace ard_c
 			ASSERT_X(index < _d->_size, "Queue::operator[]", "index out of range");
 			return _d->at(index);
 		}
-		bool operator==(const Queue<T> &other) const { return _d == other._d; }
-		Queue<T> operator=(const Queue<T> &other) const { return Queue<T>(other); }
+		bool operator==(const Queue<T, R, A> &other) const { return _d == other._d; }
+		Queue<T, R, A> &operator=(const Queue<T, R, A> &other)
+		{
+			if (_d != other._d)
+			{
+				if (R::isShareable)
+				{
+					other._d->_ref.ref();
+					release();
+					_d = other._d;
+				}
+				else
+				{
+					release();
+					_d = reinterpret_cast<QueueData<T, R, A>*>(other._d->deep_copy());
+				}
+			}
+			return *this;
+		}
 
 
 
@@ -212,68 +371,88 @@ namespace ard_c
 		class Iterator
 		{
 		public:
-			typename QueueData<T>::Node *_n;
+			QueueData<T, R, A> *_q;
+			int _i;
 			Iterator() {}
-			Iterator(typename QueueData<T>::Node *n) : _n(n) {}
-
-			T &operator*() { return *_n->_d; }
-			T *operator->() { return _n->_d; }
-			bool operator==(const Iterator &other) const { return _n == other._n; }
-			bool operator==(const ConstIterator &other) const { return _n == other._n; }
-			bool operator!=(const Iterator &other) const { return _n != other._n; }
-			bool operator!=(const ConstIterator &other) const { return _n != other._n; }
-			Iterator &operator++() { _n = _n->_n; return *this; }
-			Iterator operator++(int) { Iterator i = *this; _n = _n->_n; return i; }
-			Iterator &operator--() { _n = _n->_p; return *this; }
-			Iterator operator--(int) { Iterator i = *this; _n = _n->_p; return i; }
+			Iterator(QueueData<T, R, A> *q, int i) : _q(q), _i(i) {}
+
+			T &operator*() { return _q->at(_i); }
+			T *operator->() { return &_q->at(_i); }
+			bool operator==(const Iterator &other) const { return _i == other._i; }
+			bool operator==(const ConstIterator &other) const { return _i == other._i; }
+			bool operator!=(const Iterator &other) const { return _i != other._i; }
+			bool operator!=(const ConstIterator &other) const { return _i != other._i; }
+			Iterator &operator++() { ++_i; return *this; }
+			Iterator operator++(int) { Iterator i = *this; ++_i; return i; }
+			Iterator &operator--() { --_i; return *this; }
+			Iterator operator--(int) { Iterator i = *this; --_i; return i; }
 		};
 		friend class Iterator;
 
 		class ConstIterator
 		{
 		public:
-			typename QueueData<T>::Node *_n;
+			const QueueData<T, R, A> *_q;
+			int _i;
 			ConstIterator() {}
-			ConstIterator(typename QueueData<T>::Node *n) : _n(n) {}
-
-			const T &operator*() const { return *_n->_d; }
-			const T *operator->() const { return _n->_d; }
-			bool operator==(const Iterator &other) const { return _n == other._n; }
-			bool operator==(const ConstIterator &other) const { return _n == other._n; }
-			bool operator!=(const Iterator &other) const { return _n != other._n; }
-			bool operator!=(const ConstIterator &other) const { return _n != other._n; }
-			ConstIterator &operator++() { _n = _n->_n; return *this; }
-			ConstIterator operator++(int) { ConstIterator i = *this; _n = _n->_n; return i; }
-			ConstIterator &operator--() { _n = _n->_p; return *this; }
-			ConstIterator operator--(int) { ConstIterator i = *this; _n = _n->_p; return i; }
+			ConstIterator(const QueueData<T, R, A> *q, int i) : _q(q), _i(i) {}
+
+			const T &operator*() const { return _q->at(_i); }
+			const T *operator->() const { return &_q->at(_i); }
+			bool operator==(const Iterator &other) const { return _i == other._i; }
+			bool operator==(const ConstIterator &other) const { return _i == other._i; }
+			bool operator!=(const Iterator &other) const { return _i != other._i; }
+			bool operator!=(const ConstIterator &other) const { return _i != other._i; }
+			ConstIterator &operator++() { ++_i; return *this; }
+			ConstIterator operator++(int) { ConstIterator i = *this; ++_i; return i; }
+			ConstIterator &operator--() { --_i; return *this; }
+			ConstIterator operator--(int) { ConstIterator i = *this; --_i; return i; }
 		};
 		friend class ConstIterator;
 
-		Iterator begin() { detach(); return Iterator(_d->_first); }
-		ConstIterator cbegin() const { return ConstIterator(_d->_first); }
-		Iterator end() { detach(); return Iterator(_d->_end); }
-		ConstIterator cend() const { return ConstIterator(_d->_end); }
+		Iterator begin() { detach(); return Iterator(_d, 0); }
+		ConstIterator begin() const { return ConstIterator(_d, 0); }
+		ConstIterator cbegin() const { return ConstIterator(_d, 0); }
+		ConstIterator constBegin() const { return ConstIterator(_d, 0); }
+		Iterator end() { detach(); return Iterator(_d, _d->_size); }
+		ConstIterator end() const { return ConstIterator(_d, _d->_size); }
+		ConstIterator cend() const { return ConstIterator(_d, _d->_size); }
+		ConstIterator constEnd() const { return ConstIterator(_d, _d->_size); }
+		ConstRange<ConstIterator> constRange() const
+		{
+			ConstRange<ConstIterator> r = { constBegin(), constEnd() };
+			return r;
+		}
+
+#ifdef ARD_C_INSTRUMENT
+		const ContainerStats &stats() const { return _d->_stats; }
+#endif
 
 	private:
 		void detach()
 		{
-			if (_d->_ref.isShared())
+			if (R::isShareable && _d->_ref.isShared())
 			{
-				QueueData<T> *d = reinterpret_cast<QueueData<T>*>(_d->deep_copy());
-				_d->_ref.deref();
+				QueueData<T, R, A> *d = reinterpret_cast<QueueData<T, R, A>*>(_d->deep_copy());
+#ifdef ARD_C_INSTRUMENT
+				d->_stats.inherit(_d->_stats);
+				globalStats().queue.detached();
+#endif
+				// Un autre propriétaire peut s'être détaché entre isShared() et ici : le dernier
+				// à relâcher l'ancien buffer le détruit.
+				release();
 				_d = d;
 			}
 		}
 
+		void release()
+		{
+			if (!_d->_ref.deref()) QueueData<T, R, A>::destroy(_d);
+		}
+
 		void construct_data()
 		{
-			QueueData<T> *d = new QueueData<T>();
-			d->_ref = RefCount::init_ref();
-			d->_end = QueueData<T>::get_end_ptr();
-			d->_size = 0;
-			d->_first = 0;
-			d->_last = 0;
-			_d = d;
+			_d = QueueData<T, R, A>::create();
 		}
 	};
 
@@ -1,11 +1,23 @@
-
 #ifndef REF_COUNT_H
 #define REF_COUNT_H
 
+#include "Collection_Atomic.h"
+
 namespace ard_c 
 {
+	// Politiques de comptage de références des conteneurs partagés implicitement
+	// ( Vector, Stack, Queue ). Elles sont passées en second paramètre template :
+	//  - RefCount : compteur simple, pour un usage depuis un seul contexte d'exécution.
+	//  - AtomicRefCount : compteur atomique, pour partager des copies entre threads ou coeurs.
+	//  - UnsharedRefCount : aucun partage, une copie duplique immédiatement les données
+	//    et le copy-on-write disparait à la compilation.
+	// La politique par défaut peut être changée en définissant ARD_C_DEFAULT_REFCOUNT
+	// avant d'inclure la librairie.
+
 	struct RefCount
 	{
+		enum { isShareable = true };
+
 		int _count;
 
 		bool isShared() const { return _count > 1; }
@@ -18,6 +30,42 @@ namespace ard_c
 			return r;
 		}
 	};
+
+	struct AtomicRefCount
+	{
+		enum { isShareable = true };
+
+		volatile int _count;
+
+		bool isShared() const { return atomic_load_acquire(&_count) > 1; }
+		int ref() { return atomic_fetch_add(&_count, 1) + 1; }
+		int deref() { return atomic_fetch_sub(&_count, 1) - 1; }
+
+		static AtomicRefCount init_ref()
+		{
+			AtomicRefCount r = { 1 };
+			return r;
+		}
+	};
+
+	struct UnsharedRefCount
+	{
+		enum { isShareable = false };
+
+		bool isShared() const { return false; }
+		int ref() { return 1; }
+		int deref() { return 0; }
+
+		static UnsharedRefCount init_ref()
+		{
+			UnsharedRefCount r;
+			return r;
+		}
+	};
 }
 
+#ifndef ARD_C_DEFAULT_REFCOUNT
+	#define ARD_C_DEFAULT_REFCOUNT ard_c::RefCount
+#endif
+
 #endif	// REF_COUNT_H
@@ -0,0 +1,227 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include "Collection_Tool.h"
+#include "Collection_TypeTrait.h"
+#include "Collection_Relocation.h"
+#include "Span.h"
+
+namespace ard_c
+{
+
+	// RingBuffer
+	// Fenêtre des N derniers éléments, stockée dans l'objet : push() sur un buffer plein écrase
+	// le plus ancien au lieu d'échouer, sans allocation ni décalage. L'index 0 est le plus ancien.
+	// Le contenu tient en deux plages contiguës, firstHalf() puis secondHalf(), que l'on peut
+	// parcourir directement ( "Numeric.h" ) sans passer par un calcul d'index par élément.
+	// Un RingBuffer n'est pas partagé implicitement : une copie duplique les éléments.
+	template<typename T, int N>
+	class RingBuffer
+	{
+		static_assert(N > 0, "RingBuffer needs a positive capacity");
+
+	public:
+		typedef typename SizeType<N>::type size_type;
+
+	private:
+		size_type _size;
+		size_type _head;
+		alignas(T) unsigned char _d[sizeof(T) * N];
+
+	public:
+		RingBuffer() : _size(0), _head(0) {}
+		RingBuffer(const RingBuffer<T, N> &other) : _size(0), _head(0)
+		{
+			copy_from(other);
+		}
+		~RingBuffer()
+		{
+			clear();
+		}
+
+		static constexpr int capacity() { return N; }
+		int size() const { return _size; }
+		bool isEmpty() const { return _size == 0; }
+		bool isFull() const { return _size == N; }
+
+		// Ajoute 'value' en fin. Renvoie true si le plus ancien élément a été écrasé.
+		bool push(const T &value)
+		{
+			int size = _size;
+			if (size == N)
+			{
+				int head = _head;
+				data()[head] = value;
+				_head = (size_type)next(head);
+				return true;
+			}
+			new (data() + slot(size)) T(value);
+			_size = (size_type)(size + 1);
+			return false;
+		}
+		bool push(T &&value)
+		{
+			int size = _size;
+			if (size == N)
+			{
+				int head = _head;
+				data()[head] = ard_c::move(value);
+				_head = (size_type)next(head);
+				return true;
+			}
+			new (data() + slot(size)) T(ard_c::move(value));
+			_size = (size_type)(size + 1);
+			return false;
+		}
+		// Ajoute 'n' valeurs : seules les N dernières sont gardées.
+		void push(const T *values, int n)
+		{
+			if (n > N)
+			{
+				values += n - N;
+				n = N;
+			}
+			for (int i = 0; i < n; ++i) push(values[i]);
+		}
+
+		T takeFirst()
+		{
+			ASSERT_X(!isEmpty(), "RingBuffer::takeFirst", "buffer is empty");
+			T *d = data() + _head;
+			T r(ard_c::move(*d));
+			d->~T();
+			_head = (size_type)next(_head);
+			_size = (size_type)(_size - 1);
+			return r;
+		}
+		void removeFirst()
+		{
+			ASSERT_X(!isEmpty(), "RingBuffer::removeFirst", "buffer is empty");
+			destroy_n(data() + _head, 1);
+			_head = (size_type)next(_head);
+			_size = (size_type)(_size - 1);
+		}
+		void removeLast()
+		{
+			ASSERT_X(!isEmpty(), "RingBuffer::removeLast", "buffer is empty");
+			_size = (size_type)(_size - 1);
+			destroy_n(data() + slot(_size), 1);
+		}
+		void clear()
+		{
+			for (int i = 0; i < _size; ++i) destroy_n(data() + slot(i), 1);
+			_size = 0;
+			_head = 0;
+		}
+
+		const T &at(int index) const
+		{
+			ASSERT_X(index >= 0 && index < _size, "RingBuffer::at", "index out of range");
+			return data()[slot(index)];
+		}
+		T &operator[](int index)
+		{
+			ASSERT_X(index >= 0 && index < _size, "RingBuffer::operator[]", "index out of range");
+			return data()[slot(index)];
+		}
+		const T &operator[](int index) const
+		{
+			ASSERT_X(index >= 0 && index < _size, "RingBuffer::operator[]", "index out of range");
+			return data()[slot(index)];
+		}
+		T &first()
+		{
+			ASSERT_X(!isEmpty(), "RingBuffer::first", "buffer is empty");
+			return data()[_head];
+		}
+		const T &first() const
+		{
+			ASSERT_X(!isEmpty(), "RingBuffer::first", "buffer is empty");
+			return data()[_head];
+		}
+		T &last()
+		{
+			ASSERT_X(!isEmpty(), "RingBuffer::last", "buffer is empty");
+			return data()[slot(_size - 1)];
+		}
+		const T &last() const
+		{
+			ASSERT_X(!isEmpty(), "RingBuffer::last", "buffer is empty");
+			return data()[slot(_size - 1)];
+		}
+
+		// firstHalf / secondHalf
+		// Les éléments du plus ancien au plus récent sont firstHalf() suivi de secondHalf(),
+		// vide tant que le buffer n'a pas fait le tour.
+		Span<T> firstHalf() { return Span<T>(data() + _head, first_count()); }
+		Span<const T> firstHalf() const { return Span<const T>(data() + _head, first_count()); }
+		Span<T> secondHalf() { return Span<T>(data(), _size - first_count()); }
+		Span<const T> secondHalf() const { return Span<const T>(data(), _size - first_count()); }
+
+		RingBuffer<T, N> &operator=(const RingBuffer<T, N> &other)
+		{
+			if (this != &other)
+			{
+				clear();
+				copy_from(other);
+			}
+			return *this;
+		}
+
+
+		class ConstIterator
+		{
+		public:
+			const RingBuffer<T, N> *_r;
+			int _i;
+			ConstIterator() {}
+			ConstIterator(const RingBuffer<T, N> *r, int i) : _r(r), _i(i) {}
+
+			const T &operator*() const { return (*_r)[_i]; }
+			const T *operator->() const { return &(*_r)[_i]; }
+			bool operator==(const ConstIterator &other) const { return _i == other._i; }
+			bool operator!=(const ConstIterator &other) const { return _i != other._i; }
+			ConstIterator &operator++() { ++_i; return *this; }
+			ConstIterator operator++(int) { ConstIterator i = *this; ++_i; return i; }
+			ConstIterator &operator--() { --_i; return *this; }
+			ConstIterator operator--(int) { ConstIterator i = *this; --_i; return i; }
+		};
+		friend class ConstIterator;
+
+		ConstIterator begin() const { return ConstIterator(this, 0); }
+		ConstIterator end() const { return ConstIterator(this, _size); }
+		ConstIterator cbegin() const { return ConstIterator(this, 0); }
+		ConstIterator cend() const { return ConstIterator(this, _size); }
+
+	private:
+		T *data() { return reinterpret_cast<T*>(_d); }
+		const T *data() const { return reinterpret_cast<const T*>(_d); }
+
+		int slot(int i) const
+		{
+			int s = _head + i;
+			if ((N & (N - 1)) == 0) return s & (N - 1);
+			return s >= N ? s - N : s;
+		}
+		static int next(int i)
+		{
+			if ((N & (N - 1)) == 0) return (i + 1) & (N - 1);
+			return i + 1 == N ? 0 : i + 1;
+		}
+		int first_count() const
+		{
+			int n = N - _head;
+			return _size < n ? _size : n;
+		}
+
+		void copy_from(const RingBuffer<T, N> &other)
+		{
+			for (int i = 0; i < other._size; ++i) new (data() + i) T(other.at(i));
+			_size = other._size;
+			_head = 0;
+		}
+	};
+
+}
+
+#endif // !RING_BUFFER_H
@@ -0,0 +1,157 @@
+#ifndef ROLLING_STATS_H
+#define ROLLING_STATS_H
+
+#include <math.h>
+#include "RingBuffer.h"
+
+namespace ard_c
+{
+	// stats_type
+	// Accumulateur de RollingStats : 64 bits exacts pour les entiers, double pour les flottants.
+	template<typename T, bool _Integral = is_integral<T>::value>
+	struct stats_type
+	{ typedef double type; };
+	template<typename T>
+	struct stats_type<T, true>
+	{ typedef int64_t type; };
+
+
+	// RollingStats
+	// Statistiques des N derniers échantillons, tenues à jour à chaque add() au lieu de
+	// reparcourir la fenêtre à chaque lecture :
+	// - somme et somme des carrés, ajoutées pour l'échantillon entrant et retranchées pour celui
+	//   qui sort. Elles portent sur l'écart à une valeur de référence ( le premier échantillon )
+	//   pour que la variance ne soit pas la différence de deux grands nombres. Exactes pour
+	//   les entiers tant que N * ( x - ref )² tient sur 64 bits ; pour les flottants, elles sont
+	//   recalculées depuis la fenêtre tous les N échantillons, ce qui borne la dérive des
+	//   arrondis pour un coût amorti constant.
+	// - minimum et maximum par deux files monotones : un échantillon qui ne pourra plus être
+	//   le minimum, parce qu'un plus petit est arrivé après lui, est retiré tout de suite.
+	//   Chaque échantillon entre et sort au plus une fois : O( 1 ) amorti.
+	// Tout tient dans l'objet, sans allocation.
+	template<typename T, int N>
+	class RollingStats
+	{
+		static_assert(is_integral<T>::value || is_floating_point<T>::value, "RollingStats needs an arithmetic type");
+
+	public:
+		typedef typename stats_type<T>::type accum_type;
+
+	private:
+		struct Entry
+		{
+			T value;
+			uint32_t seq;
+		};
+
+		RingBuffer<T, N> _samples;
+		// Candidats au minimum ( valeurs strictement croissantes ) et au maximum ( strictement
+		// décroissantes ), du plus ancien au plus récent.
+		RingBuffer<Entry, N> _min;
+		RingBuffer<Entry, N> _max;
+		accum_type _ref;
+		accum_type _sum;
+		accum_type _sumSq;
+		uint32_t _seq;
+
+	public:
+		RollingStats() : _ref(0), _sum(0), _sumSq(0), _seq(0) {}
+
+		static constexpr int capacity() { return N; }
+		int count() const { return _samples.size(); }
+		bool isEmpty() const { return _samples.isEmpty(); }
+		bool isFull() const { return _samples.isFull(); }
+		const RingBuffer<T, N> &samples() const { return _samples; }
+
+		void add(T x)
+		{
+			if (_samples.isEmpty()) _ref = (accum_type)x;
+			else if (_samples.isFull())
+			{
+				accum_type d = (accum_type)_samples.first() - _ref;
+				_sum -= d;
+				_sumSq -= d * d;
+			}
+			_samples.push(x);
+			accum_type d = (accum_type)x - _ref;
+			_sum += d;
+			_sumSq += d * d;
+
+			// L'entrée de tête sort de la fenêtre après N échantillons.
+			if (!_min.isEmpty() && (uint32_t)(_seq - _min.first().seq) >= (uint32_t)N) _min.removeFirst();
+			if (!_max.isEmpty() && (uint32_t)(_seq - _max.first().seq) >= (uint32_t)N) _max.removeFirst();
+			while (!_min.isEmpty() && !(_min.last().value < x)) _min.removeLast();
+			while (!_max.isEmpty() && !(x < _max.last().value)) _max.removeLast();
+			Entry e = { x, _seq };
+			_min.push(e);
+			_max.push(e);
+
+			++_seq;
+			if (!is_integral<T>::value && _seq % N == 0) resum();
+		}
+		void add(const T *values, int n)
+		{
+			for (int i = 0; i < n; ++i) add(values[i]);
+		}
+		void clear()
+		{
+			_samples.clear();
+			_min.clear();
+			_max.clear();
+			_ref = 0;
+			_sum = 0;
+			_sumSq = 0;
+			_seq = 0;
+		}
+
+		accum_type sum() const { return _sum + _ref * (accum_type)count(); }
+		double mean() const
+		{
+			ASSERT_X(!isEmpty(), "RollingStats::mean", "no sample");
+			return (double)_ref + (double)_sum / count();
+		}
+		// Variance de la population ( division par count() ).
+		double variance() const
+		{
+			ASSERT_X(!isEmpty(), "RollingStats::variance", "no sample");
+			double n = count();
+			double s = (double)_sum;
+			double v = ((double)_sumSq - s * s / n) / n;
+			return v > 0 ? v : 0;
+		}
+		double stddev() const { return sqrt(variance()); }
+		T minimum() const
+		{
+			ASSERT_X(!isEmpty(), "RollingStats::minimum", "no sample");
+			return _min.first().value;
+		}
+		T maximum() const
+		{
+			ASSERT_X(!isEmpty(), "RollingStats::maximum", "no sample");
+			return _max.first().value;
+		}
+
+	private:
+		// Recalcule les sommes autour de la moyenne courante.
+		void resum()
+		{
+			_ref = (accum_type)mean();
+			_sum = 0;
+			_sumSq = 0;
+			accumulate(_samples.firstHalf());
+			accumulate(_samples.secondHalf());
+		}
+		void accumulate(Span<const T> s)
+		{
+			for (const T *p = s.begin(); p != s.end(); ++p)
+			{
+				accum_type d = (accum_type)*p - _ref;
+				_sum += d;
+				_sumSq += d * d;
+			}
+		}
+	};
+}
+
+
+#endif // !ROLLING_STATS_H
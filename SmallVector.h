@@ -0,0 +1,265 @@
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+
+#include "Vector.h"
+
+namespace ard_c
+{
+
+	// SmallVector
+	// Vector dont les N premiers éléments sont stockés dans l'objet lui même.
+	// Tant que la taille ne dépasse pas N aucune allocation n'est faite, au delà
+	// les éléments sont déplacés dans un buffer sur le tas qui grandit par puissance de 2.
+	// Contrairement à Vector, SmallVector n'est pas partagé implicitement : une copie
+	// duplique toujours les éléments.
+	template<typename T, int N>
+	class SmallVector
+	{
+		static_assert(N > 0, "SmallVector needs at least one inline element");
+
+		T *_d;
+		int _size;
+		int _capacity;
+		alignas(T) unsigned char _inline[sizeof(T) * N];
+
+	public:
+		typedef typename Vector<T>::Iterator Iterator;
+		typedef typename Vector<T>::ConstIterator ConstIterator;
+
+		SmallVector() : _d(inline_data()), _size(0), _capacity(N) {}
+		SmallVector(int alloc) : _d(inline_data()), _size(0), _capacity(N)
+		{
+			reserve(alloc);
+		}
+		SmallVector(const SmallVector<T, N> &other) : _d(inline_data()), _size(0), _capacity(N)
+		{
+			append(other);
+		}
+		SmallVector(SmallVector<T, N> &&other) : _d(inline_data()), _size(0), _capacity(N)
+		{
+			steal(other);
+		}
+		~SmallVector()
+		{
+			release();
+		}
+
+
+		int size() const { return _size; }
+		bool isEmpty() const { return _size == 0; }
+		int capacity() const { return _capacity; }
+		bool isInline() const { return _d == inline_data(); }
+		const T &at(int index) const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((index < _size && index >= 0), "SmallVector::at", "index out of range");
+#endif
+			return _d[index];
+		}
+		T &first()
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "SmallVector::first", "vector is empty");
+#endif
+			return _d[0];
+		}
+		const T &first() const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "SmallVector::first", "vector is empty");
+#endif
+			return _d[0];
+		}
+		T &last()
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "SmallVector::last", "vector is empty");
+#endif
+			return _d[_size - 1];
+		}
+		const T &last() const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "SmallVector::last", "vector is empty");
+#endif
+			return _d[_size - 1];
+		}
+
+		void reserve(int alloc)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(alloc >= 0, "SmallVector::reserve", "allocation must be a positive integer");
+#endif
+			if (alloc > _capacity) grow((int)nextPowerOfTwo(alloc));
+		}
+
+		template<typename... Args>
+		void emplaceBack(Args&&... args)
+		{
+			if (_size == _capacity)
+			{
+				// Les arguments peuvent référencer un élément du SmallVector.
+				T t(ard_c::forward<Args>(args)...);
+				grow((int)nextPowerOfTwo(_capacity));
+				new (_d + _size) T(ard_c::move(t));
+			}
+			else new (_d + _size) T(ard_c::forward<Args>(args)...);
+			++_size;
+		}
+		template<typename... Args>
+		void emplace(int before, Args&&... args)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((before >= 0 && before < _size + 1), "SmallVector::emplace", "index out of range");
+#endif
+			if (before == _size) { emplaceBack(ard_c::forward<Args>(args)...); return; }
+			T t(ard_c::forward<Args>(args)...);
+			if (_size == _capacity) grow((int)nextPowerOfTwo(_capacity));
+			relocate_n(_d + before + 1, _d + before, _size - before);
+			new (_d + before) T(ard_c::move(t));
+			++_size;
+		}
+
+		void append(const T &value) { emplaceBack(value); }
+		void append(T &&value) { emplaceBack(ard_c::move(value)); }
+		void append(const SmallVector<T, N> &other)
+		{
+			int n = other._size;
+			if (_size + n > _capacity) grow((int)nextPowerOfTwo(_size + n));
+			copy_construct_n(_d + _size, other._d, n);
+			_size += n;
+		}
+		void insert(const T &value, int before) { emplace(before, value); }
+		void insert(T &&value, int before) { emplace(before, ard_c::move(value)); }
+		void prepend(const T &value) { emplace(0, value); }
+		void prepend(T &&value) { emplace(0, ard_c::move(value)); }
+		void remove(int index)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((index >= 0 && index < _size), "SmallVector::remove", "index out of range");
+#endif
+			destroy_n(_d + index, 1);
+			relocate_n(_d + index, _d + index + 1, _size - index - 1);
+			--_size;
+		}
+		void removeFirst() { remove(0); }
+		void removeLast() { remove(_size - 1); }
+
+		T take(int index)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((index >= 0 && index < _size), "SmallVector::take", "index out of range");
+#endif
+			T t(ard_c::move(_d[index]));
+			remove(index);
+			return t;
+		}
+		T takeFirst() { return take(0); }
+		T takeLast() { return take(_size - 1); }
+
+
+		T &operator[](int index)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((index < _size && index >= 0), "SmallVector::operator[]", "index out of range");
+#endif
+			return _d[index];
+		}
+		const T &operator[](int index) const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((index < _size && index >= 0), "SmallVector::operator[]", "index out of range");
+#endif
+			return _d[index];
+		}
+		SmallVector<T, N> &operator=(const SmallVector<T, N> &other)
+		{
+			if (this != &other)
+			{
+				destroy_n(_d, _size);
+				_size = 0;
+				append(other);
+			}
+			return *this;
+		}
+		SmallVector<T, N> &operator=(SmallVector<T, N> &&other)
+		{
+			if (this != &other)
+			{
+				release();
+				_d = inline_data();
+				_size = 0;
+				_capacity = N;
+				steal(other);
+			}
+			return *this;
+		}
+		bool operator==(const SmallVector<T, N> &other) const
+		{
+			if (_size != other._size) return false;
+			for (int i = 0; i < _size; ++i)
+			{
+				if (!(_d[i] == other._d[i])) return false;
+			}
+			return true;
+		}
+		SmallVector<T, N> &operator<<(const T &value) { append(value); return *this; }
+		SmallVector<T, N> &operator<<(T &&value) { append(ard_c::move(value)); return *this; }
+		SmallVector<T, N> &operator<<(const SmallVector<T, N> &other) { append(other); return *this; }
+
+
+		inline Iterator begin() { return Iterator(_d); }
+		inline ConstIterator cbegin() const { return ConstIterator(_d); }
+		inline Iterator end() { return Iterator(_d + _size); }
+		inline ConstIterator cend() const { return ConstIterator(_d + _size); }
+
+
+	private:
+		T *inline_data() { return reinterpret_cast<T*>(_inline); }
+		const T *inline_data() const { return reinterpret_cast<const T*>(_inline); }
+
+		void grow(int capacity)
+		{
+			T *d;
+			if (isInline())
+			{
+				d = reinterpret_cast<T*>(::malloc(sizeof(T) * capacity));
+				if (d) relocate_n(d, _d, _size);
+			}
+			else d = reallocate<HeapAllocator>(_d, _size, _capacity, capacity);
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(d, "SmallVector::grow", "bad alloc");
+#endif
+			_d = d;
+			_capacity = capacity;
+		}
+
+		void release()
+		{
+			destroy_n(_d, _size);
+			if (!isInline()) free(_d);
+		}
+
+		void steal(SmallVector<T, N> &other)
+		{
+			if (other.isInline())
+			{
+				relocate_n(_d, other._d, other._size);
+				_size = other._size;
+			}
+			else
+			{
+				_d = other._d;
+				_size = other._size;
+				_capacity = other._capacity;
+				other._d = other.inline_data();
+				other._capacity = N;
+			}
+			other._size = 0;
+		}
+	};
+
+}
+
+#endif // !SMALL_VECTOR_H
@@ -0,0 +1,268 @@
+#ifndef SOA_VECTOR_H
+#define SOA_VECTOR_H
+
+#include "Collection_Tool.h"
+#include "Collection_TypeTrait.h"
+#include "Collection_Relocation.h"
+#include "Collection_Allocator.h"
+#include "Span.h"
+
+namespace ard_c
+{
+	// SoAElement
+	// Type du champ I de la liste F...
+	template<int I, typename... F>
+	struct SoAElement;
+	template<typename T, typename... F>
+	struct SoAElement<0, T, F...>
+	{
+		typedef T type;
+	};
+	template<int I, typename T, typename... F>
+	struct SoAElement<I, T, F...> : SoAElement<I - 1, F...> {};
+
+
+	// SoAColumns
+	// Colonnes d'un SoAVector, une classe de base par champ : chaque niveau possède le buffer de
+	// son champ et transmet l'opération au niveau suivant. Toutes les colonnes ont la même taille
+	// et la même capacité, gérées par le SoAVector.
+	template<typename A, typename... F>
+	struct SoAColumns
+	{
+		void reallocate(int, int, int) {}
+		void deallocate(int) {}
+		void construct(int) {}
+		void construct_default(int, int) {}
+		void relocate(int, int, int) {}
+		void destroy(int, int) {}
+		void copy_from(const SoAColumns<A, F...> &, int) {}
+	};
+	template<typename A, typename T, typename... F>
+	struct SoAColumns<A, T, F...> : SoAColumns<A, F...>
+	{
+		typedef SoAColumns<A, F...> Next;
+		T *_d;
+
+		SoAColumns() : _d(0) {}
+
+		void reallocate(int size, int capacity, int newCapacity)
+		{
+			T *d = capacity ? ard_c::reallocate<A>(_d, size, capacity, newCapacity) : reinterpret_cast<T*>(A::allocate(sizeof(T) * newCapacity));
+			ASSERT_X(d, "SoAVector::reserve", "bad alloc");
+			_d = d;
+			Next::reallocate(size, capacity, newCapacity);
+		}
+		void deallocate(int capacity)
+		{
+			if (capacity) A::deallocate(_d, sizeof(T) * capacity);
+			_d = 0;
+			Next::deallocate(capacity);
+		}
+		template<typename U, typename... Us>
+		void construct(int i, U &&value, Us&&... values)
+		{
+			new (_d + i) T(ard_c::forward<U>(value));
+			Next::construct(i, ard_c::forward<Us>(values)...);
+		}
+		void construct_default(int i, int n)
+		{
+			fill_construct_n(_d + i, T(), n);
+			Next::construct_default(i, n);
+		}
+		// Déplace les lignes [src, src + n[ vers 'dest', les plages peuvent se chevaucher.
+		void relocate(int dest, int src, int n)
+		{
+			relocate_n(_d + dest, _d + src, n);
+			Next::relocate(dest, src, n);
+		}
+		void destroy(int i, int n)
+		{
+			destroy_n(_d + i, n);
+			Next::destroy(i, n);
+		}
+		void copy_from(const SoAColumns<A, T, F...> &other, int n)
+		{
+			copy_construct_n(_d, other._d, n);
+			Next::copy_from(other, n);
+		}
+	};
+
+	// SoAColumnsAt
+	// Niveau de SoAColumns qui porte le champ I.
+	template<int I, typename A, typename... F>
+	struct SoAColumnsAt;
+	template<typename A, typename T, typename... F>
+	struct SoAColumnsAt<0, A, T, F...>
+	{
+		typedef SoAColumns<A, T, F...> type;
+	};
+	template<int I, typename A, typename T, typename... F>
+	struct SoAColumnsAt<I, A, T, F...> : SoAColumnsAt<I - 1, A, F...> {};
+
+
+	// BasicSoAVector / SoAVector
+	// Tableau d'enregistrements stocké par colonnes ( structure of arrays ) : chaque champ F a son
+	// propre buffer contigu. Une boucle qui ne lit qu'un champ ne charge que ce champ en cache, et
+	// column<I>() renvoie une Span directement utilisable par "Numeric.h" ou "Algorithm.h".
+	//
+	//     SoAVector<uint32_t, uint8_t, float> readings;	// timestamp, voie, valeur
+	//     readings.append(t, channel, value);
+	//     double total = sum(readings.column<2>().begin(), readings.column<2>().end());
+	//
+	// Les opérations par ligne ( append, insert, remove ) traitent toutes les colonnes ensemble.
+	// Les valeurs d'une ligne sont prises par valeur : elles peuvent référencer un élément du
+	// conteneur même si l'ajout réalloue. Les colonnes grandissent par puissances de deux, comme
+	// un Vector. Un SoAVector n'est pas partagé implicitement : une copie duplique les colonnes.
+	// SoAVector utilise l'allocateur par défaut ; BasicSoAVector prend la politique en premier
+	// paramètre, avant la liste des champs.
+	template<typename A, typename... F>
+	class BasicSoAVector
+	{
+		static_assert(sizeof...(F) > 0, "SoAVector needs at least one field");
+
+		SoAColumns<A, F...> _c;
+		int _size;
+		int _capacity;
+
+		template<int I>
+		typename SoAColumnsAt<I, A, F...>::type &columns() { return _c; }
+		template<int I>
+		const typename SoAColumnsAt<I, A, F...>::type &columns() const { return _c; }
+
+	public:
+		enum { Fields = sizeof...(F) };
+
+		BasicSoAVector() : _size(0), _capacity(0) {}
+		BasicSoAVector(int alloc) : _size(0), _capacity(0) { reserve(alloc); }
+		BasicSoAVector(const BasicSoAVector<A, F...> &other) : _size(0), _capacity(0) { copy_from(other); }
+		~BasicSoAVector()
+		{
+			clear();
+			_c.deallocate(_capacity);
+		}
+
+		int size() const { return _size; }
+		bool isEmpty() const { return _size == 0; }
+		int capacity() const { return _capacity; }
+		// Capacité exacte, comme Vector::reserve().
+		void reserve(int n)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(n >= 0, "SoAVector::reserve", "allocation must be a positive integer");
+#endif
+			if (n <= _capacity) return;
+			_c.reallocate(_size, _capacity, n);
+			_capacity = n;
+		}
+
+		// Colonne du champ I, valable jusqu'à la prochaine modification de la taille.
+		template<int I>
+		Span<typename SoAElement<I, F...>::type> column() { return Span<typename SoAElement<I, F...>::type>(columns<I>()._d, _size); }
+		template<int I>
+		Span<const typename SoAElement<I, F...>::type> column() const { return Span<const typename SoAElement<I, F...>::type>(columns<I>()._d, _size); }
+		template<int I>
+		typename SoAElement<I, F...>::type &at(int row)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((row >= 0 && row < _size), "SoAVector::at", "index out of range");
+#endif
+			return columns<I>()._d[row];
+		}
+		template<int I>
+		const typename SoAElement<I, F...>::type &at(int row) const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((row >= 0 && row < _size), "SoAVector::at", "index out of range");
+#endif
+			return columns<I>()._d[row];
+		}
+
+		void append(F... values)
+		{
+			if (_size == _capacity) grow(_size + 1);
+			_c.construct(_size, ard_c::move(values)...);
+			++_size;
+		}
+		void insert(int row, F... values)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((row >= 0 && row <= _size), "SoAVector::insert", "index out of range");
+#endif
+			if (_size == _capacity) grow(_size + 1);
+			_c.relocate(row + 1, row, _size - row);
+			_c.construct(row, ard_c::move(values)...);
+			++_size;
+		}
+		void remove(int row) { remove(row, 1); }
+		void remove(int row, int n)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((row >= 0 && n >= 0 && row + n <= _size), "SoAVector::remove", "index out of range");
+#endif
+			if (!n) return;
+			_c.destroy(row, n);
+			_c.relocate(row, row + n, _size - row - n);
+			_size -= n;
+		}
+		void removeLast()
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(_size > 0, "SoAVector::removeLast", "vector is empty");
+#endif
+			_c.destroy(--_size, 1);
+		}
+		// Les nouvelles lignes sont construites par défaut, à remplir colonne par colonne.
+		void resize(int size)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(size >= 0, "SoAVector::resize", "size must be a positive integer");
+#endif
+			if (size <= _size)
+			{
+				_c.destroy(size, _size - size);
+				_size = size;
+				return;
+			}
+			if (size > _capacity) grow(size);
+			_c.construct_default(_size, size - _size);
+			_size = size;
+		}
+		// Détruit les lignes en conservant la capacité.
+		void clear()
+		{
+			_c.destroy(0, _size);
+			_size = 0;
+		}
+
+		BasicSoAVector<A, F...> &operator=(const BasicSoAVector<A, F...> &other)
+		{
+			if (this != &other)
+			{
+				clear();
+				copy_from(other);
+			}
+			return *this;
+		}
+
+	private:
+		void grow(int n)
+		{
+			int newCap = _capacity ? _capacity : 1;
+			while (newCap < n) newCap = (int)nextPowerOfTwo(newCap);
+			reserve(newCap);
+		}
+		void copy_from(const BasicSoAVector<A, F...> &other)
+		{
+			if (!other._size) return;
+			reserve(other._size);
+			_c.copy_from(other._c, other._size);
+			_size = other._size;
+		}
+	};
+
+	template<typename... F>
+	using SoAVector = BasicSoAVector<ARD_C_DEFAULT_ALLOCATOR, F...>;
+}
+
+
+#endif // !SOA_VECTOR_H
@@ -0,0 +1,40 @@
+#ifndef SPAN_H
+#define SPAN_H
+
+#include "Collection_Tool.h"
+
+namespace ard_c
+{
+	// Span
+	// Vue non propriétaire sur 'size' éléments contigus. Ne copie rien et ne prolonge pas la durée
+	// de vie des éléments : la vue n'est valable que tant que son conteneur n'est pas modifié.
+	// begin() / end() sont des pointeurs, utilisables avec "Algorithm.h" et "Numeric.h".
+	template<typename T>
+	class Span
+	{
+		T *_d;
+		int _size;
+
+	public:
+		Span() : _d(0), _size(0) {}
+		Span(T *d, int size) : _d(d), _size(size) {}
+		// Span<T> -> Span<const T>
+		template<typename U>
+		Span(const Span<U> &other) : _d(other.data()), _size(other.size()) {}
+
+		int size() const { return _size; }
+		bool isEmpty() const { return _size == 0; }
+		T *data() const { return _d; }
+		T &operator[](int index) const
+		{
+			ASSERT_X(index >= 0 && index < _size, "Span::operator[]", "index out of range");
+			return _d[index];
+		}
+
+		T *begin() const { return _d; }
+		T *end() const { return _d + _size; }
+	};
+}
+
+
+#endif // !SPAN_H
@@ -0,0 +1,159 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include "Collection_Tool.h"
+#include "Collection_TypeTrait.h"
+#include "Collection_Relocation.h"
+#include "Collection_Atomic.h"
+
+namespace ard_c
+{
+
+	// SpscQueue
+	// File sans verrou à un seul producteur et un seul consommateur, de capacité fixe N
+	// ( puissance de 2 ). Prévue pour transmettre des échantillons d'une interruption à loop() :
+	// aucune allocation, pas de partage implicite et aucun appel bloquant.
+	//
+	// Le producteur ( push, pushN ) et le consommateur ( pop, popN ) peuvent s'exécuter en
+	// parallèle, mais chaque côté ne doit être utilisé que depuis un seul contexte.
+	// Les index tournent librement sur le plus petit entier capable de contenir N : avec N <= 128
+	// ce sont des uint8_t, dont l'accès est atomique sans masquer les interruptions sur AVR.
+	template<typename T, int N>
+	class SpscQueue
+	{
+		static_assert(N > 0 && (N & (N - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+	public:
+		typedef typename SizeType<N>::type size_type;
+
+	private:
+		// Côté producteur : _head est publié, _tailCache évite de relire _tail à chaque push.
+		ARD_C_CACHE_ALIGNED volatile size_type _head;
+		size_type _tailCache;
+		// Côté consommateur.
+		ARD_C_CACHE_ALIGNED volatile size_type _tail;
+		size_type _headCache;
+		// alignas(T) : sans ARD_C_CACHE_ALIGNED ( cibles embarquées ), le buffer suit directement les
+		// compteurs d'un octet. Le plus strict des deux alignements s'applique.
+		ARD_C_CACHE_ALIGNED alignas(T) unsigned char _d[sizeof(T) * N];
+
+	public:
+		SpscQueue() : _head(0), _tailCache(0), _tail(0), _headCache(0) {}
+		~SpscQueue()
+		{
+			size_type t = _tail;
+			while (t != _head) { data()[t & (N - 1)].~T(); ++t; }
+		}
+
+		static constexpr int capacity() { return N; }
+
+		// Nombre d'éléments en attente. Exact depuis le producteur ou le consommateur
+		// pour leur propre côté, approximatif pour un observateur tiers.
+		int size() const
+		{
+			return (size_type)(atomic_load_acquire(&_head) - atomic_load_acquire(&_tail));
+		}
+		bool isEmpty() const { return size() == 0; }
+		bool isFull() const { return size() == N; }
+
+
+		// Producteur
+
+		template<typename... Args>
+		bool emplace(Args&&... args)
+		{
+			size_type h = atomic_load_relaxed(&_head);
+			if ((size_type)(h - _tailCache) == N)
+			{
+				_tailCache = atomic_load_acquire(&_tail);
+				if ((size_type)(h - _tailCache) == N) return false;
+			}
+			new (data() + (h & (N - 1))) T(ard_c::forward<Args>(args)...);
+			atomic_store_release(&_head, (size_type)(h + 1));
+			return true;
+		}
+		bool push(const T &value) { return emplace(value); }
+		bool push(T &&value) { return emplace(ard_c::move(value)); }
+
+		// Copie jusqu'à 'n' éléments de 'src' et renvoie le nombre réellement ajouté.
+		// Un seul index est publié pour tout le lot.
+		int pushN(const T *src, int n)
+		{
+			size_type h = atomic_load_relaxed(&_head);
+			int room = N - (size_type)(h - _tailCache);
+			if (room < n)
+			{
+				_tailCache = atomic_load_acquire(&_tail);
+				room = N - (size_type)(h - _tailCache);
+			}
+			if (n > room) n = room;
+			if (n <= 0) return 0;
+
+			int s = h & (N - 1);
+			int first = N - s;
+			if (first > n) first = n;
+			copy_construct_n(data() + s, src, first);
+			copy_construct_n(data(), src + first, n - first);
+			atomic_store_release(&_head, (size_type)(h + n));
+			return n;
+		}
+
+
+		// Consommateur
+
+		bool pop(T &out)
+		{
+			size_type t = atomic_load_relaxed(&_tail);
+			if (t == _headCache)
+			{
+				_headCache = atomic_load_acquire(&_head);
+				if (t == _headCache) return false;
+			}
+			T *d = data() + (t & (N - 1));
+			out = ard_c::move(*d);
+			d->~T();
+			atomic_store_release(&_tail, (size_type)(t + 1));
+			return true;
+		}
+
+		// Renvoie sans le retirer le prochain élément, ou 0 si la file est vide.
+		T *peek()
+		{
+			size_type t = atomic_load_relaxed(&_tail);
+			if (t == _headCache)
+			{
+				_headCache = atomic_load_acquire(&_head);
+				if (t == _headCache) return 0;
+			}
+			return data() + (t & (N - 1));
+		}
+
+		// Déplace jusqu'à 'n' éléments dans 'dst' et renvoie le nombre réellement retiré.
+		int popN(T *dst, int n)
+		{
+			size_type t = atomic_load_relaxed(&_tail);
+			int avail = (size_type)(_headCache - t);
+			if (avail < n)
+			{
+				_headCache = atomic_load_acquire(&_head);
+				avail = (size_type)(_headCache - t);
+			}
+			if (n > avail) n = avail;
+			if (n <= 0) return 0;
+
+			int s = t & (N - 1);
+			int first = N - s;
+			if (first > n) first = n;
+			move_out_n(dst, data() + s, first);
+			move_out_n(dst + first, data(), n - first);
+			atomic_store_release(&_tail, (size_type)(t + n));
+			return n;
+		}
+
+	private:
+		T *data() { return reinterpret_cast<T*>(_d); }
+	};
+
+}
+
+#endif // !SPSC_QUEUE_H
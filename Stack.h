@@ -6,12 +6,13 @@
 
 namespace ard_c
 {
-	template<typename T>
-	class Stack : public Vector<T>
+	template<typename T, typename R = ARD_C_DEFAULT_REFCOUNT, typename A = ARD_C_DEFAULT_ALLOCATOR>
+	class Stack : public Vector<T, R, A>
 	{
 	public:
-		void push(const T &value) { Vector<T>::append(value); }
-		T pop() { return Vector<T>::takeLast(); }
+		void push(const T &value) { Vector<T, R, A>::append(value); }
+		void push(T &&value) { Vector<T, R, A>::append(ard_c::move(value)); }
+		T pop() { return Vector<T, R, A>::takeLast(); }
 	};
 }
 
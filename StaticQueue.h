@@ -0,0 +1,209 @@
+#ifndef STATIC_QUEUE_H
+#define STATIC_QUEUE_H
+
+#include "Queue.h"
+
+namespace ard_c
+{
+
+	// StaticQueue
+	// Queue à capacité fixe N : buffer circulaire stocké dans l'objet, aucune allocation sur le tas.
+	// enqueue() sur une file pleine déclenche une assertion, tryEnqueue() renvoie false à la place.
+	// Les index utilisent le plus petit type entier capable de contenir N ( uint8_t pour N < 256 ).
+	// Une StaticQueue n'est pas partagée implicitement : une copie duplique les éléments.
+	template<typename T, int N>
+	class StaticQueue
+	{
+		static_assert(N > 0, "StaticQueue needs a positive capacity");
+
+	public:
+		typedef typename SizeType<N>::type size_type;
+
+	private:
+		size_type _size;
+		size_type _head;
+		alignas(T) unsigned char _d[sizeof(T) * N];
+
+	public:
+		StaticQueue() : _size(0), _head(0) {}
+		StaticQueue(const StaticQueue<T, N> &other) : _size(0), _head(0)
+		{
+			copy_from(other);
+		}
+		~StaticQueue()
+		{
+			clear();
+		}
+
+		static constexpr int capacity() { return N; }
+		int size() const { return _size; }
+		bool isEmpty() const { return _size == 0; }
+		bool isFull() const { return _size == N; }
+		const T &at(int index) const
+		{
+			ASSERT_X(index < _size, "StaticQueue::at", "index out of range");
+			return data()[slot(index)];
+		}
+
+		template<typename... Args>
+		bool tryEmplaceEnqueue(Args&&... args)
+		{
+			// Les compteurs sont lus avant l'écriture de l'élément : un uint8_t peut être
+			// aliasé par n'importe quelle écriture et serait sinon relu depuis la mémoire.
+			int size = _size;
+			if (size == N) return false;
+			new (data() + slot(size)) T(ard_c::forward<Args>(args)...);
+			_size = (size_type)(size + 1);
+			return true;
+		}
+		template<typename... Args>
+		void emplaceEnqueue(Args&&... args)
+		{
+			ASSERT_X(!isFull(), "StaticQueue::enqueue", "Queue is full");
+			tryEmplaceEnqueue(ard_c::forward<Args>(args)...);
+		}
+		bool tryEnqueue(const T &value) { return tryEmplaceEnqueue(value); }
+		bool tryEnqueue(T &&value) { return tryEmplaceEnqueue(ard_c::move(value)); }
+		void enqueue(const T &value) { emplaceEnqueue(value); }
+		void enqueue(T &&value) { emplaceEnqueue(ard_c::move(value)); }
+
+		T dequeue()
+		{
+			ASSERT_X(!isEmpty(), "StaticQueue::dequeue", "Queue is empty");
+			int size = _size;
+			int head = _head;
+			T *d = data() + head;
+			_head = (size_type)slot(1);
+			_size = (size_type)(size - 1);
+			T r(ard_c::move(*d));
+			d->~T();
+			return r;
+		}
+		bool tryDequeue(T &out)
+		{
+			if (isEmpty()) return false;
+			out = dequeue();
+			return true;
+		}
+		void clear()
+		{
+			for (int i = 0; i < _size; ++i) destroy_n(data() + slot(i), 1);
+			_size = 0;
+			_head = 0;
+		}
+
+		T &first()
+		{
+			ASSERT_X(!isEmpty(), "StaticQueue::first", "Queue is empty");
+			return data()[_head];
+		}
+		const T &first() const
+		{
+			ASSERT_X(!isEmpty(), "StaticQueue::first", "Queue is empty");
+			return data()[_head];
+		}
+		T &last()
+		{
+			ASSERT_X(!isEmpty(), "StaticQueue::last", "Queue is empty");
+			return data()[slot(_size - 1)];
+		}
+		const T &last() const
+		{
+			ASSERT_X(!isEmpty(), "StaticQueue::last", "Queue is empty");
+			return data()[slot(_size - 1)];
+		}
+
+
+		T &operator[](int index)
+		{
+			ASSERT_X(index < _size, "StaticQueue::operator[]", "index out of range");
+			return data()[slot(index)];
+		}
+		const T &operator[](int index) const
+		{
+			ASSERT_X(index < _size, "StaticQueue::operator[]", "index out of range");
+			return data()[slot(index)];
+		}
+		StaticQueue<T, N> &operator=(const StaticQueue<T, N> &other)
+		{
+			if (this != &other)
+			{
+				clear();
+				copy_from(other);
+			}
+			return *this;
+		}
+
+
+
+		class ConstIterator;
+
+		class Iterator
+		{
+		public:
+			StaticQueue<T, N> *_q;
+			int _i;
+			Iterator() {}
+			Iterator(StaticQueue<T, N> *q, int i) : _q(q), _i(i) {}
+
+			T &operator*() { return (*_q)[_i]; }
+			T *operator->() { return &(*_q)[_i]; }
+			bool operator==(const Iterator &other) const { return _i == other._i; }
+			bool operator==(const ConstIterator &other) const { return _i == other._i; }
+			bool operator!=(const Iterator &other) const { return _i != other._i; }
+			bool operator!=(const ConstIterator &other) const { return _i != other._i; }
+			Iterator &operator++() { ++_i; return *this; }
+			Iterator operator++(int) { Iterator i = *this; ++_i; return i; }
+			Iterator &operator--() { --_i; return *this; }
+			Iterator operator--(int) { Iterator i = *this; --_i; return i; }
+		};
+		friend class Iterator;
+
+		class ConstIterator
+		{
+		public:
+			const StaticQueue<T, N> *_q;
+			int _i;
+			ConstIterator() {}
+			ConstIterator(const StaticQueue<T, N> *q, int i) : _q(q), _i(i) {}
+
+			const T &operator*() const { return (*_q)[_i]; }
+			const T *operator->() const { return &(*_q)[_i]; }
+			bool operator==(const Iterator &other) const { return _i == other._i; }
+			bool operator==(const ConstIterator &other) const { return _i == other._i; }
+			bool operator!=(const Iterator &other) const { return _i != other._i; }
+			bool operator!=(const ConstIterator &other) const { return _i != other._i; }
+			ConstIterator &operator++() { ++_i; return *this; }
+			ConstIterator operator++(int) { ConstIterator i = *this; ++_i; return i; }
+			ConstIterator &operator--() { --_i; return *this; }
+			ConstIterator operator--(int) { ConstIterator i = *this; --_i; return i; }
+		};
+		friend class ConstIterator;
+
+		Iterator begin() { return Iterator(this, 0); }
+		ConstIterator cbegin() const { return ConstIterator(this, 0); }
+		Iterator end() { return Iterator(this, _size); }
+		ConstIterator cend() const { return ConstIterator(this, _size); }
+
+	private:
+		T *data() { return reinterpret_cast<T*>(_d); }
+		const T *data() const { return reinterpret_cast<const T*>(_d); }
+
+		int slot(int i) const
+		{
+			int s = _head + i;
+			if ((N & (N - 1)) == 0) return s & (N - 1);
+			return s >= N ? s - N : s;
+		}
+
+		void copy_from(const StaticQueue<T, N> &other)
+		{
+			for (int i = 0; i < other._size; ++i) new (data() + i) T(other.at(i));
+			_size = other._size;
+			_head = 0;
+		}
+	};
+
+}
+
+#endif // !STATIC_QUEUE_H
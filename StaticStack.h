@@ -0,0 +1,21 @@
+#ifndef STATIC_STACK_H
+#define STATIC_STACK_H
+
+#include "StaticVector.h"
+
+namespace ard_c
+{
+	template<typename T, int N>
+	class StaticStack : public StaticVector<T, N>
+	{
+	public:
+		void push(const T &value) { StaticVector<T, N>::append(value); }
+		void push(T &&value) { StaticVector<T, N>::append(ard_c::move(value)); }
+		bool tryPush(const T &value) { return StaticVector<T, N>::tryAppend(value); }
+		bool tryPush(T &&value) { return StaticVector<T, N>::tryAppend(ard_c::move(value)); }
+		T pop() { return StaticVector<T, N>::takeLast(); }
+	};
+}
+
+
+#endif // !STATIC_STACK_H
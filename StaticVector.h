@@ -0,0 +1,210 @@
+#ifndef STATIC_VECTOR_H
+#define STATIC_VECTOR_H
+
+
+#include "Vector.h"
+
+namespace ard_c
+{
+
+	// StaticVector
+	// Vector à capacité fixe N, stocké entièrement dans l'objet : aucune allocation sur le tas.
+	// Les ajouts sur un StaticVector plein déclenchent une assertion, tryAppend() permet de
+	// tester l'ajout sans assertion. Le compteur de taille utilise le plus petit type entier
+	// capable de contenir N ( uint8_t pour N < 256 ).
+	// Un StaticVector n'est pas partagé implicitement : une copie duplique les éléments.
+	template<typename T, int N>
+	class StaticVector
+	{
+		static_assert(N > 0, "StaticVector needs a positive capacity");
+
+	public:
+		typedef typename SizeType<N>::type size_type;
+		typedef typename Vector<T>::Iterator Iterator;
+		typedef typename Vector<T>::ConstIterator ConstIterator;
+
+	private:
+		size_type _size;
+		alignas(T) unsigned char _d[sizeof(T) * N];
+
+	public:
+		StaticVector() : _size(0) {}
+		StaticVector(const StaticVector<T, N> &other) : _size(0)
+		{
+			copy_construct_n(data(), other.data(), other._size);
+			_size = other._size;
+		}
+		~StaticVector()
+		{
+			destroy_n(data(), _size);
+		}
+
+
+		static constexpr int capacity() { return N; }
+		int size() const { return _size; }
+		bool isEmpty() const { return _size == 0; }
+		bool isFull() const { return _size == N; }
+		const T &at(int index) const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((index < _size && index >= 0), "StaticVector::at", "index out of range");
+#endif
+			return data()[index];
+		}
+		T &first()
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "StaticVector::first", "vector is empty");
+#endif
+			return data()[0];
+		}
+		const T &first() const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "StaticVector::first", "vector is empty");
+#endif
+			return data()[0];
+		}
+		T &last()
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "StaticVector::last", "vector is empty");
+#endif
+			return data()[_size - 1];
+		}
+		const T &last() const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "StaticVector::last", "vector is empty");
+#endif
+			return data()[_size - 1];
+		}
+
+		template<typename... Args>
+		bool tryEmplaceBack(Args&&... args)
+		{
+			int size = _size;
+			if (size == N) return false;
+			new (data() + size) T(ard_c::forward<Args>(args)...);
+			_size = (size_type)(size + 1);
+			return true;
+		}
+		template<typename... Args>
+		void emplaceBack(Args&&... args)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isFull(), "StaticVector::emplaceBack", "vector is full");
+#endif
+			tryEmplaceBack(ard_c::forward<Args>(args)...);
+		}
+		template<typename... Args>
+		bool tryEmplace(int before, Args&&... args)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((before >= 0 && before < _size + 1), "StaticVector::emplace", "index out of range");
+#endif
+			if (isFull()) return false;
+			T t(ard_c::forward<Args>(args)...);
+			relocate_n(data() + before + 1, data() + before, _size - before);
+			new (data() + before) T(ard_c::move(t));
+			++_size;
+			return true;
+		}
+		template<typename... Args>
+		void emplace(int before, Args&&... args)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isFull(), "StaticVector::emplace", "vector is full");
+#endif
+			tryEmplace(before, ard_c::forward<Args>(args)...);
+		}
+
+		bool tryAppend(const T &value) { return tryEmplaceBack(value); }
+		bool tryAppend(T &&value) { return tryEmplaceBack(ard_c::move(value)); }
+		void append(const T &value) { emplaceBack(value); }
+		void append(T &&value) { emplaceBack(ard_c::move(value)); }
+		void insert(const T &value, int before) { emplace(before, value); }
+		void insert(T &&value, int before) { emplace(before, ard_c::move(value)); }
+		void prepend(const T &value) { emplace(0, value); }
+		void prepend(T &&value) { emplace(0, ard_c::move(value)); }
+		void remove(int index)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((index >= 0 && index < _size), "StaticVector::remove", "index out of range");
+#endif
+			destroy_n(data() + index, 1);
+			relocate_n(data() + index, data() + index + 1, _size - index - 1);
+			--_size;
+		}
+		void removeFirst() { remove(0); }
+		void removeLast() { remove(_size - 1); }
+		void clear()
+		{
+			destroy_n(data(), _size);
+			_size = 0;
+		}
+
+		T take(int index)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((index >= 0 && index < _size), "StaticVector::take", "index out of range");
+#endif
+			T t(ard_c::move(data()[index]));
+			remove(index);
+			return t;
+		}
+		T takeFirst() { return take(0); }
+		T takeLast() { return take(_size - 1); }
+
+
+		T &operator[](int index)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((index < _size && index >= 0), "StaticVector::operator[]", "index out of range");
+#endif
+			return data()[index];
+		}
+		const T &operator[](int index) const
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((index < _size && index >= 0), "StaticVector::operator[]", "index out of range");
+#endif
+			return data()[index];
+		}
+		StaticVector<T, N> &operator=(const StaticVector<T, N> &other)
+		{
+			if (this != &other)
+			{
+				clear();
+				copy_construct_n(data(), other.data(), other._size);
+				_size = other._size;
+			}
+			return *this;
+		}
+		bool operator==(const StaticVector<T, N> &other) const
+		{
+			if (_size != other._size) return false;
+			for (int i = 0; i < _size; ++i)
+			{
+				if (!(data()[i] == other.data()[i])) return false;
+			}
+			return true;
+		}
+		StaticVector<T, N> &operator<<(const T &value) { append(value); return *this; }
+		StaticVector<T, N> &operator<<(T &&value) { append(ard_c::move(value)); return *this; }
+
+
+		inline Iterator begin() { return Iterator(data()); }
+		inline ConstIterator cbegin() const { return ConstIterator(const_cast<T*>(data())); }
+		inline Iterator end() { return Iterator(data() + _size); }
+		inline ConstIterator cend() const { return ConstIterator(const_cast<T*>(data()) + _size); }
+
+
+	private:
+		T *data() { return reinterpret_cast<T*>(_d); }
+		const T *data() const { return reinterpret_cast<const T*>(_d); }
+	};
+
+}
+
+#endif // !STATIC_VECTOR_H
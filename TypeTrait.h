@@ -35,6 +35,10 @@ namespace ard_c
 	// Struct de commodité renvoyant false quoi qu'il arrive.
 	typedef integral_constant<bool, false> false_type;
 
+	// true_type
+	// Struct de commodité renvoyant true quoi qu'il arrive.
+	typedef integral_constant<bool, true> true_type;
+
 
 	// __is_integral_helper
 	// Défini quels sont les types integral.
@@ -71,6 +75,16 @@ namespace ard_c
 	_DEFINE_SPEC(__is_floating_point_helper, long double, true)
 	
 
+	// conditional
+	// Sélectionne un type à la compilation : renvoie A si _Cond est vrai, B sinon.
+	template<bool _Cond, typename A, typename B>
+	struct conditional
+	{ typedef A type; };
+	template<typename A, typename B>
+	struct conditional<false, A, B>
+	{ typedef B type; };
+
+
 	// remove_volatile
 	// Supprime la composante volatile d'un type T pour renvoyer
 	// systématiquement son type 'non volatile'.
@@ -134,6 +148,56 @@ namespace ard_c
 	{ };
 
 
+	// remove_reference
+	// Supprime la composante référence ( lvalue ou rvalue ) d'un type T.
+	template<typename T>
+	struct remove_reference
+	{ typedef T type; };
+	template<typename T>
+	struct remove_reference<T&>
+	{ typedef T type; };
+	template<typename T>
+	struct remove_reference<T&&>
+	{ typedef T type; };
+
+
+	// move
+	// Equivalent de std::move, indisponible sur AVR.
+	// Converti 'v' en rvalue pour permettre le déplacement de ses ressources.
+	template<typename T>
+	inline typename remove_reference<T>::type &&move(T &&v)
+	{
+		return static_cast<typename remove_reference<T>::type&&>(v);
+	}
+
+
+	// forward
+	// Equivalent de std::forward, indisponible sur AVR.
+	// Transmet un argument en conservant sa catégorie lvalue / rvalue d'origine.
+	template<typename T>
+	inline T &&forward(typename remove_reference<T>::type &v)
+	{
+		return static_cast<T&&>(v);
+	}
+	template<typename T>
+	inline T &&forward(typename remove_reference<T>::type &&v)
+	{
+		return static_cast<T&&>(v);
+	}
+
+
+	// swap
+	// Equivalent de std::swap, indisponible sur AVR.
+	// Echange 'a' et 'b' par déplacement.
+	template<typename T>
+	inline void swap(T &a, T &b)
+	{
+		T t(ard_c::move(a));
+		a = ard_c::move(b);
+		b = ard_c::move(t);
+	}
+
+
 	// is_enum
 	// Défini si un type T est une énumération.
 	//   /\    Nécessite la méthode magique __is_enum du compilateur.
@@ -142,6 +206,28 @@ namespace ard_c
 	template<typename T>
 	struct is_enum : public integral_constant<bool, __is_enum(T)>
 	{ };
+
+
+	// is_trivially_copyable
+	// Défini si un type T peut être copié octet par octet ( memcpy ) et n'a pas de destructeur,
+	// ce qui est le cas des struct simples type 'struct Sample { int16_t x, y, z; }'.
+	//   /\    Nécessite les méthodes magiques __is_trivially_copyable ( gcc >= 5, clang ) ou
+	//  /!!\   __has_trivial_copy / __has_trivial_destructor ( gcc >= 4.3 ) du compilateur.
+	//  ¯¯¯¯   Sans elles le trait renvoie false et les types doivent être déclarés avec ARD_C_DECLARE_TYPEINFO.
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+	template<typename T>
+	struct is_trivially_copyable : public integral_constant<bool, __is_trivially_copyable(T)>
+	{ };
+#elif defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 3))
+	template<typename T>
+	struct is_trivially_copyable
+		: public integral_constant<bool, __has_trivial_copy(T) && __has_trivial_destructor(T)>
+	{ };
+#else
+	template<typename T>
+	struct is_trivially_copyable : public false_type
+	{ };
+#endif
 }
 
 #endif	// TYPETRAIT_H
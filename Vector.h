@@ -6,29 +6,61 @@
 #include "RefCount.h"
 #include "Collection_Tool.h"
 #include "Collection_TypeTrait.h"
+#include "Collection_Relocation.h"
+#include "Collection_Allocator.h"
+#include "Collection_Instrument.h"
 
 #define LAUNCH_ASSERT
 
 namespace ard_c
 {
 
-	template<typename T>
+	template<typename T, typename R = ARD_C_DEFAULT_REFCOUNT, typename A = ARD_C_DEFAULT_ALLOCATOR>
 	struct VectorData
 	{
-		RefCount _ref;
+		R _ref;
 		int _size;
 		int _capacity;
 		T *_d;
+#ifdef ARD_C_INSTRUMENT
+		ContainerStats _stats;
+#endif
+
+
+		static VectorData<T, R, A> *create()
+		{
+			void *p = A::allocate(sizeof(VectorData<T, R, A>));
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(p, "VectorData::create", "bad alloc");
+#endif
+			VectorData<T, R, A> *d = new (p) VectorData<T, R, A>();
+			d->_ref = R::init_ref();
+			d->_size = 0;
+			d->_capacity = 0;
+			d->_d = 0;
+			ARD_C_STATS(d, vector, allocated(sizeof(VectorData<T, R, A>)));
+			return d;
+		}
+		static void destroy(VectorData<T, R, A> *d)
+		{
+			d->clear();
+			ARD_C_STATS(d, vector, freed(sizeof(VectorData<T, R, A>)));
+			d->~VectorData<T, R, A>();
+			A::deallocate(d, sizeof(VectorData<T, R, A>));
+		}
 
 
+		void allocate(int n)
+		{
+			_d = reinterpret_cast<T*>(A::allocate(sizeof(T) * n));
+			if (!_d) failed_alloc_purge();
+			ARD_C_STATS(this, vector, allocated(sizeof(T) * n));
+			_capacity = n;
+		}
+
 		void resize()
 		{
-			if (!_capacity)
-			{
-				_d = reinterpret_cast<T*>(::malloc(sizeof(T)));
-				if (!_d) failed_alloc_purge();
-				_capacity++;
-			}
+			if (!_capacity) allocate(1);
 			else if (_size == _capacity)
 			{
 				int newCap = (int)nextPowerOfTwo(_capacity);
@@ -42,27 +74,36 @@ namespace ard_c
 #endif
 			if (n <= _capacity) return;
 			int newCap = (int)nextPowerOfTwo(n);
-			if (!_capacity)
-			{
-				_d = reinterpret_cast<T*>(::malloc(sizeof(T) * newCap));
-				if (!_d) failed_alloc_purge();
-				_capacity = newCap;
-			}
+			if (!_capacity) allocate(newCap);
 			else realloc(newCap);
 		}
 
+		// Capacité exacte : un conteneur sur une arène ou un pool ne consomme que ce qui est réservé.
+		void reserve(int n)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(n >= 0, "VectorData::reserve", "allocation must be a positive integer");
+#endif
+			if (n <= _capacity) return;
+			if (!_capacity) allocate(n);
+			else realloc(n);
+		}
+
 		void realloc(int growth)
 		{
 #ifdef LAUNCH_ASSERT
 			ASSERT_X(growth >= 0, "VectorData::realloc", "allocation must be a positive integer");
 #endif
-			_d = reinterpret_cast<T*>(::realloc(_d, sizeof(T) * growth));
-			if (!_d) failed_alloc_purge();
+			T *d = reallocate<A>(_d, _size, _capacity, growth);
+			if (!d) failed_alloc_purge();
+			ARD_C_STATS(this, vector, reallocated(sizeof(T) * _capacity, sizeof(T) * growth));
+			_d = d;
 			_capacity = growth;
 		}
 		void failed_alloc_purge()
 		{
-			free(_d);
+			A::deallocate(_d, sizeof(T) * _capacity);
+			ARD_C_STATS(this, vector, freed(sizeof(T) * _capacity));
 			_capacity = 0;
 			_size = 0;
 #ifdef LAUNCH_ASSERT
@@ -73,82 +114,173 @@ namespace ard_c
 
 		void *deep_copy()
 		{
-			VectorData<T> *dest = new VectorData<T>();
-			dest->_ref = RefCount::init_ref();
+			VectorData<T, R, A> *dest = create();
+			if (!_capacity) return dest;
+			T *d = reinterpret_cast<T*>(A::allocate(sizeof(T) * _capacity));
+			if (!d) failed_alloc_purge();
+			ARD_C_STATS(dest, vector, allocated(sizeof(T) * _capacity));
+			copy_construct_n(d, _d, _size);
+			dest->_d = d;
 			dest->_capacity = _capacity;
 			dest->_size = _size;
-			if (TypeTrait<T>::isAtomic)
-			{
-				T *d = reinterpret_cast<T*>(::malloc(sizeof(T) * _capacity));
-				if (!d) failed_alloc_purge();
-				::memcpy(d, _d, sizeof(T) * _size);
-				dest->_d = d;
-			}
-			else
-			{
-				T *c = reinterpret_cast<T*>(::malloc(sizeof(T) * _capacity));
-				if (!c) failed_alloc_purge();
-				dest->_d = c;
-				int n = 0;
-				while (n < _size)
-				{
-					new (c) T(_d[n]);
-					++c;
-					++n;
-				}
-			}
 			return dest;
 		}
 
-		void append(const T &v)
+		template<typename... Args>
+		void emplaceBack(Args&&... args)
 		{
+			if (_size == _capacity)
+			{
+				// Les arguments peuvent référencer un élément du Vector : on construit
+				// la valeur avant que la réallocation ne les invalide.
+				T t(ard_c::forward<Args>(args)...);
+				resize();
+				new (_d + _size) T(ard_c::move(t));
+				++_size;
+				return;
+			}
+			// _size est lu une seule fois : l'écriture de l'élément pourrait sinon forcer sa relecture
+			// quand le compilateur ne peut pas prouver que le buffer ne recouvre pas l'en-tête.
+			int size = _size;
+			new (_d + size) T(ard_c::forward<Args>(args)...);
+			_size = size + 1;
+		}
+		template<typename... Args>
+		void emplace(int i, Args&&... args)
+		{
+			if (i == _size) { emplaceBack(ard_c::forward<Args>(args)...); return; }
+			T t(ard_c::forward<Args>(args)...);
 			resize();
-			_d[_size] = v;
+			relocate_n(_d + i + 1, _d + i, _size - i);
+			ARD_C_STATS(this, vector, moved(sizeof(T) * (_size - i)));
+			new (_d + i) T(ard_c::move(t));
 			++_size;
 		}
-		void append(T *range, int size)
+
+		void append(const T &v) { emplaceBack(v); }
+		void append(T &&v) { emplaceBack(ard_c::move(v)); }
+		void append(const T *range, int size)
 		{
 			int rc = _size - _capacity + size;
 			if (rc > 0) resize(_capacity + rc);
-			int newSize = _size + size;
-			while (_size != newSize)
+			copy_construct_n(_d + _size, range, size);
+			_size += size;
+		}
+		void insert(const T &v, int i) { emplace(i, v); }
+		void insert(T &&v, int i) { emplace(i, ard_c::move(v)); }
+		void insert(int i, const T *range, int size)
+		{
+			if (size <= 0) return;
+			if (_size + size > _capacity) resize(_size + size);
+			relocate_n(_d + i + size, _d + i, _size - i);
+			ARD_C_STATS(this, vector, moved(sizeof(T) * (_size - i)));
+			copy_construct_n(_d + i, range, size);
+			_size += size;
+		}
+		void prepend(const T &v) { emplace(0, v); }
+		void prepend(T &&v) { emplace(0, ard_c::move(v)); }
+		void remove(int i) { remove(i, 1); }
+		void remove(int i, int size)
+		{
+			destroy_n(_d + i, size);
+			relocate_n(_d + i, _d + i + size, _size - i - size);
+			ARD_C_STATS(this, vector, moved(sizeof(T) * (_size - i - size)));
+			_size -= size;
+		}
+		// Un seul passage. Les types primitifs sont recopiés un par un, les autres
+		// sont déplacés par suites d'éléments conservés.
+		template<typename P>
+		int removeIf(P pred)
+		{
+			int w = removeIf(pred, integral_constant<bool, TypeTrait<T>::isPrimitive>());
+			int removed = _size - w;
+			_size = w;
+			return removed;
+		}
+		template<typename P>
+		int removeIf(P pred, true_type)
+		{
+			int size = _size;
+			int w = 0;
+			for (int r = 0; r < size; ++r)
 			{
-				_d[_size] = *range;
-				++_size;
-				++range;
+				T v = _d[r];
+				_d[w] = v;
+				w += !pred(v);
 			}
+			ARD_C_STATS(this, vector, moved(sizeof(T) * w));
+			return w;
 		}
-		void insert(const T &v, int i)
+		template<typename P>
+		int removeIf(P pred, false_type)
 		{
-			if (i == _size || _size == 0) { append(v); return; }
-			resize();
-			int x = _size - i;
-			::memmove(_d + i + 1, _d + i, sizeof(T) * x);
-			_d[i] = v;
-			++_size;
+			int w = 0;
+			int r = 0;
+			while (r < _size)
+			{
+				// Le prédicat n'est appelé qu'une fois par élément : la suite conservée
+				// s'arrête sur un élément à retirer, détruit sans nouvel appel.
+				int start = r;
+				while (r < _size && !pred(_d[r])) ++r;
+				if (w != start && r != start)
+				{
+					relocate_n(_d + w, _d + start, r - start);
+					ARD_C_STATS(this, vector, moved(sizeof(T) * (r - start)));
+				}
+				w += r - start;
+				if (r < _size)
+				{
+					destroy_n(_d + r, 1);
+					++r;
+				}
+			}
+			return w;
 		}
-		void prepend(const T &v)
+		void truncate(int size)
 		{
-			insert(v, 0);
+			destroy_n(_d + size, _size - size);
+			_size = size;
 		}
-		void remove(int i)
+		void resize(int size, const T &v)
 		{
-			if (int c = _size - i - 1)
+			if (size <= _size) { truncate(size); return; }
+			if (size > _capacity)
 			{
-				::memmove(_d + i, _d + i + 1, sizeof(T) * c);
+				// 'v' peut référencer un élément du Vector.
+				T t(v);
+				resize(size);
+				fill_construct_n(_d + _size, t, size - _size);
 			}
-			--_size;
+			else fill_construct_n(_d + _size, v, size - _size);
+			_size = size;
+		}
+		void fill(const T &v)
+		{
+			for (int i = 0; i < _size; ++i) _d[i] = v;
+		}
+		T take(int i)
+		{
+			T t(ard_c::move(_d[i]));
+			remove(i);
+			return t;
 		}
 
 		T &at(int i) { return _d[i]; }
 		const T &at(int i) const { return _d[i]; }
+
+		void clear()
+		{
+			destroy_n(_d, _size);
+			A::deallocate(_d, sizeof(T) * _capacity);
+			ARD_C_STATS(this, vector, freed(sizeof(T) * _capacity));
+		}
 	};
 
 
-	template<typename T>
+	template<typename T, typename R = ARD_C_DEFAULT_REFCOUNT, typename A = ARD_C_DEFAULT_ALLOCATOR>
 	class Vector
 	{
-		VectorData<T> *_d;
+		VectorData<T, R, A> *_d;
 
 	public:
 		Vector()
@@ -160,22 +292,24 @@ namespace ard_c
 			construct_data();
 			reserve(alloc);
 		}
-		Vector(const Vector<T> &other) : _d(other._d)
+		Vector(const Vector<T, R, A> &other) : _d(other._d)
 		{
-			_d->_ref.ref();
+			if (R::isShareable) _d->_ref.ref();
+			else _d = reinterpret_cast<VectorData<T, R, A>*>(other._d->deep_copy());
 		}
 		~Vector()
 		{
-			if (!_d->_ref.deref())
-			{
-				free(_d);
-			}
+			release();
 		}
 
 
 		int size() const { return _d->_size; }
 		bool isEmpty() const { return _d->_size == 0; }
 		int capacity() const { return _d->_capacity; }
+		// Pointeur sur les éléments contigus. La version non constante provoque un detach().
+		T *data() { detach(); return _d->_d; }
+		const T *data() const { return _d->_d; }
+		const T *constData() const { return _d->_d; }
 		const T &at(int index) const
 		{
 #ifdef LAUNCH_ASSERT
@@ -188,7 +322,8 @@ namespace ard_c
 #ifdef LAUNCH_ASSERT
 			ASSERT_X(!isEmpty(), "Vector::first", "vector is empty");
 #endif
-			return *begin();
+			detach();
+			return _d->at(0);
 		}
 		const T &first() const
 		{
@@ -202,7 +337,8 @@ namespace ard_c
 #ifdef LAUNCH_ASSERT
 			ASSERT_X(!isEmpty(), "Vector::last", "vector is empty");
 #endif
-			return *(--end());
+			detach();
+			return _d->at(_d->_size - 1);
 		}
 		const T &last() const
 		{
@@ -215,7 +351,7 @@ namespace ard_c
 		void reserve(int alloc)
 		{
 			detach();
-			_d->resize(alloc);
+			_d->reserve(alloc);
 		}
 
 		void append(const T &value)
@@ -223,7 +359,12 @@ namespace ard_c
 			detach();
 			_d->append(value);
 		}
-		void append(const Vector<T> &other)
+		void append(T &&value)
+		{
+			detach();
+			_d->append(ard_c::move(value));
+		}
+		void append(const Vector<T, R, A> &other)
 		{
 			detach();
 			_d->append(other._d->_d, other._d->_size);
@@ -236,11 +377,52 @@ namespace ard_c
 			detach();
 			_d->insert(value, before);
 		}
+		void insert(T &&value, int before)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((before >= 0 && before < _d->_size + 1), "Vector::insert", "index out of range");
+#endif
+			detach();
+			_d->insert(ard_c::move(value), before);
+		}
+		// Insère les 'n' éléments de 'range' avant l'index 'before'. 'range' ne doit pas pointer dans le
+		// buffer du Vector ; il peut pointer dans une copie partagée, qui garde l'ancien buffer.
+		void insert(int before, const T *range, int n)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((before >= 0 && before < _d->_size + 1), "Vector::insert", "index out of range");
+#endif
+			detach();
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((range + n <= _d->_d || range >= _d->_d + _d->_capacity), "Vector::insert", "range aliases the vector");
+#endif
+			_d->insert(before, range, n);
+		}
 		void prepend(const T &value)
 		{
 			detach();
 			_d->prepend(value);
 		}
+		void prepend(T &&value)
+		{
+			detach();
+			_d->prepend(ard_c::move(value));
+		}
+		template<typename... Args>
+		void emplace(int before, Args&&... args)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((before >= 0 && before < _d->_size + 1), "Vector::emplace", "index out of range");
+#endif
+			detach();
+			_d->emplace(before, ard_c::forward<Args>(args)...);
+		}
+		template<typename... Args>
+		void emplaceBack(Args&&... args)
+		{
+			detach();
+			_d->emplaceBack(ard_c::forward<Args>(args)...);
+		}
 		void remove(int index)
 		{
 #ifdef LAUNCH_ASSERT
@@ -249,8 +431,62 @@ namespace ard_c
 			detach();
 			_d->remove(index);
 		}
+		void remove(int index, int n)
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X((index >= 0 && n >= 0 && index + n <= _d->_size), "Vector::remove", "range out of range");
+#endif
+			if (!n) return;
+			detach();
+			_d->remove(index, n);
+		}
 		void removeFirst() { remove(0); }
-		void removeLast() { remove(_d->_size - 1); }
+		void removeLast()
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(!isEmpty(), "Vector::removeLast", "vector is empty");
+#endif
+			// Rien à décaler : pas de passage par remove() et son memmove de zéro octet.
+			detach();
+			_d->truncate(_d->_size - 1);
+		}
+		// Supprime les éléments pour lesquels pred(element) est vrai, renvoie leur nombre.
+		template<typename P>
+		int removeIf(P pred)
+		{
+			detach();
+			return _d->removeIf(pred);
+		}
+
+		// Change la taille du Vector : les éléments en trop sont détruits, les nouveaux sont des copies de 'value'.
+		void resize(int size, const T &value = T())
+		{
+#ifdef LAUNCH_ASSERT
+			ASSERT_X(size >= 0, "Vector::resize", "size must be a positive integer");
+#endif
+			detach();
+			_d->resize(size, value);
+		}
+		// Affecte 'value' à tous les éléments, après avoir redimensionné le Vector à 'size' si 'size' vaut au moins 0.
+		void fill(const T &value, int size = -1)
+		{
+			if (size >= 0) resize(size, value);
+			detach();
+			_d->fill(value);
+		}
+		// Supprime tous les éléments en conservant la capacité. Un Vector partagé ne copie pas
+		// ses éléments : il quitte le partage pour un buffer vide de même capacité.
+		void clear()
+		{
+			if (R::isShareable && _d->_ref.isShared())
+			{
+				int capacity = _d->_capacity;
+				release();
+				construct_data();
+				_d->reserve(capacity);
+			}
+			else _d->truncate(0);
+		}
 
 		T take(int index)
 		{
@@ -258,9 +494,7 @@ namespace ard_c
 			ASSERT_X((index >= 0 && index < _d->_size), "Vector::take", "index out of range");
 #endif
 			detach();
-			T t = _d->at(index);
-			_d->remove(index);
-			return t;
+			return _d->take(index);
 		}
 		T takeFirst() { return take(0); }
 		T takeLast() { return take(_d->_size - 1); }
@@ -281,16 +515,28 @@ namespace ard_c
 #endif
 			return _d->at(index);
 		}
-		Vector<T> &operator=(const Vector<T> &other) 
+		Vector<T, R, A> &operator=(const Vector<T, R, A> &other) 
 		{ 
-			if (_d->_ref.isShared()) _d->_ref.deref();
-			_d = other._d;
-			_d->_ref.ref();
+			if (_d != other._d)
+			{
+				if (R::isShareable)
+				{
+					other._d->_ref.ref();
+					release();
+					_d = other._d;
+				}
+				else
+				{
+					release();
+					_d = reinterpret_cast<VectorData<T, R, A>*>(other._d->deep_copy());
+				}
+			}
 			return *this;
 		}
-		bool operator==(const Vector<T> &other) const { return _d == other._d; }
-		Vector<T> &operator<<(const T &value) { append(value); return *this; }
-		Vector<T> &operator<<(const Vector<T> &other) { append(other); return *this; }
+		bool operator==(const Vector<T, R, A> &other) const { return _d == other._d; }
+		Vector<T, R, A> &operator<<(const T &value) { append(value); return *this; }
+		Vector<T, R, A> &operator<<(T &&value) { append(ard_c::move(value)); return *this; }
+		Vector<T, R, A> &operator<<(const Vector<T, R, A> &other) { append(other); return *this; }
 
 
 		class ConstIterator;
@@ -365,30 +611,49 @@ namespace ard_c
 
 
 		inline Iterator begin() { detach(); return Iterator(_d->_d); }
+		inline ConstIterator begin() const { return ConstIterator(_d->_d); }
 		inline ConstIterator cbegin() const { return ConstIterator(_d->_d); }
+		inline ConstIterator constBegin() const { return ConstIterator(_d->_d); }
 		inline Iterator end() { detach(); return Iterator(_d->_d + _d->_size); }
+		inline ConstIterator end() const { return ConstIterator(_d->_d + _d->_size); }
 		inline ConstIterator cend() const { return ConstIterator(_d->_d + _d->_size); }
+		inline ConstIterator constEnd() const { return ConstIterator(_d->_d + _d->_size); }
+		inline ConstRange<ConstIterator> constRange() const
+		{
+			ConstRange<ConstIterator> r = { constBegin(), constEnd() };
+			return r;
+		}
+
+#ifdef ARD_C_INSTRUMENT
+		const ContainerStats &stats() const { return _d->_stats; }
+#endif
 
 
 	private:
 		void detach()
 		{
-			if (_d->_ref.isShared())
+			if (R::isShareable && _d->_ref.isShared())
 			{
-				VectorData<T> *d = reinterpret_cast<VectorData<T>*>(_d->deep_copy());
-				_d->_ref.deref();
+				VectorData<T, R, A> *d = reinterpret_cast<VectorData<T, R, A>*>(_d->deep_copy());
+#ifdef ARD_C_INSTRUMENT
+				d->_stats.inherit(_d->_stats);
+				globalStats().vector.detached();
+#endif
+				// Un autre propriétaire peut s'être détaché entre isShared() et ici : le dernier
+				// à relâcher l'ancien buffer le détruit.
+				release();
 				_d = d;
 			}
 		}
 
+		void release()
+		{
+			if (!_d->_ref.deref()) VectorData<T, R, A>::destroy(_d);
+		}
+
 		void construct_data()
 		{
-			VectorData<T> *d = new VectorData<T>();
-			d->_ref = RefCount::init_ref();
-			d->_capacity = 0;
-			d->_size = 0;
-			d->_d = 0;
-			_d = d;
+			_d = VectorData<T, R, A>::create();
 		}
 	};
 
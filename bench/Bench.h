@@ -0,0 +1,110 @@
+#ifndef ARD_C_BENCH_H
+#define ARD_C_BENCH_H
+
+// Petit harnais de micro-benchmark pour le build host.
+// Chaque fichier bench_*.cpp enregistre ses cas avec BENCH_CASE, le main
+// les exécute et écrit les résultats en CSV ou JSON (voir bench_main.cpp).
+
+#include <stdio.h>
+#include <time.h>
+
+namespace bench
+{
+	struct Result
+	{
+		const char *suite;
+		const char *name;
+		const char *impl;
+		long n;
+		double nsPerOp;
+	};
+
+	class Reporter
+	{
+	public:
+		Reporter() : _count(0), _capacity(0), _results(0), _scale(1) {}
+		~Reporter();
+
+		// Facteur appliqué aux tailles de travail des cas ( --scale ).
+		long scaled(long n) const { long s = (long)(n * _scale); return s > 0 ? s : 1; }
+		void setScale(double s) { _scale = s; }
+
+		void add(const char *suite, const char *name, const char *impl, long n, double seconds);
+
+		void writeCsv(FILE *out) const;
+		void writeJson(FILE *out) const;
+
+	private:
+		int _count;
+		int _capacity;
+		Result *_results;
+		double _scale;
+	};
+
+	typedef void (*CaseFn)(Reporter &);
+
+	struct Case
+	{
+		const char *name;
+		CaseFn fn;
+		Case *next;
+
+		Case(const char *n, CaseFn f);
+		static Case *&head();
+	};
+
+
+	inline double now()
+	{
+		timespec t;
+		clock_gettime(CLOCK_MONOTONIC, &t);
+		return (double)t.tv_sec + (double)t.tv_nsec * 1e-9;
+	}
+
+	// Empêche le compilateur de supprimer un calcul dont le résultat n'est pas utilisé.
+	template<typename T>
+	inline void doNotOptimize(const T &v)
+	{
+		asm volatile("" : : "r,m"(v) : "memory");
+	}
+	inline void clobber()
+	{
+		asm volatile("" : : : "memory");
+	}
+
+	// Exécute 'f' 'reps' fois et renvoie la meilleure durée mesurée, en secondes.
+	// 'f' fait elle même sa préparation hors chrono si besoin via le Timer reçu.
+	class Timer
+	{
+	public:
+		Timer() : _elapsed(0), _start(0) {}
+		void start() { _start = now(); }
+		void stop() { _elapsed += now() - _start; }
+		double elapsed() const { return _elapsed; }
+	private:
+		double _elapsed;
+		double _start;
+	};
+
+	template<typename F>
+	double measure(F f, int reps = 5)
+	{
+		double best = 1e30;
+		for (int r = 0; r < reps; ++r)
+		{
+			Timer t;
+			f(t);
+			if (t.elapsed() < best) best = t.elapsed();
+		}
+		return best;
+	}
+}
+
+#define BENCH_CONCAT_(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_(a, b)
+#define BENCH_CASE(name) \
+	static void BENCH_CONCAT(bench_fn_, name)(bench::Reporter &); \
+	static bench::Case BENCH_CONCAT(bench_case_, name)(#name, &BENCH_CONCAT(bench_fn_, name)); \
+	static void BENCH_CONCAT(bench_fn_, name)(bench::Reporter &report)
+
+#endif	// ARD_C_BENCH_H
@@ -0,0 +1,123 @@
+#include "Bench.h"
+#include "Algorithm.h"
+
+#include <algorithm>
+#include <stdlib.h>
+
+using namespace ard_c;
+
+
+namespace
+{
+	// ~2k lectures, la taille d'un filtre médian typique.
+	const int readingCount = 2048;
+
+	void fill_readings(Vector<int> &v, unsigned seed)
+	{
+		srand(seed);
+		v.clear();
+		v.reserve(readingCount);
+		for (int i = 0; i < readingCount; ++i) v.append(rand() % 4096 - 2048);
+	}
+
+	void bubble_sort(int *d, int n)
+	{
+		for (int i = 0; i < n - 1; ++i)
+			for (int j = 0; j < n - 1 - i; ++j)
+				if (d[j + 1] < d[j]) ard_c::swap(d[j], d[j + 1]);
+	}
+
+	template<typename F>
+	double sort_case(long n, F f)
+	{
+		return bench::measure([&](bench::Timer &t) {
+			Vector<int> v;
+			long sum = 0;
+			for (long i = 0; i < n; ++i)
+			{
+				fill_readings(v, (unsigned)i);
+				t.start();
+				f(v.data(), v.size());
+				t.stop();
+				sum += v.at(readingCount / 2);
+			}
+			bench::doNotOptimize(sum);
+		});
+	}
+}
+
+
+BENCH_CASE(algorithm_sort_int)
+{
+	const long n = report.scaled(200);
+	report.add("algorithm", "sort_int", "ard_c_radix", n * readingCount, sort_case(n, [](int *d, int s) { ard_c::sort(d, d + s); }));
+	report.add("algorithm", "sort_int", "ard_c_intro", n * readingCount, sort_case(n, [](int *d, int s) { ard_c::sort(d, d + s, Less<int>()); }));
+	report.add("algorithm", "sort_int", "std", n * readingCount, sort_case(n, [](int *d, int s) { std::sort(d, d + s); }));
+	report.add("algorithm", "sort_int", "bubble", report.scaled(4) * readingCount, sort_case(report.scaled(4), bubble_sort));
+}
+
+BENCH_CASE(algorithm_sort_float)
+{
+	const long n = report.scaled(200);
+	Vector<float> src;
+	srand(1);
+	for (int i = 0; i < readingCount; ++i) src.append((float)rand() / RAND_MAX);
+	report.add("algorithm", "sort_float", "ard_c", n * readingCount, bench::measure([&](bench::Timer &t) {
+		for (long i = 0; i < n; ++i)
+		{
+			Vector<float> v = src;
+			float *d = v.data();
+			t.start();
+			ard_c::sort(d, d + v.size());
+			t.stop();
+			bench::doNotOptimize(d[0]);
+		}
+	}));
+	report.add("algorithm", "sort_float", "std", n * readingCount, bench::measure([&](bench::Timer &t) {
+		for (long i = 0; i < n; ++i)
+		{
+			Vector<float> v = src;
+			float *d = v.data();
+			t.start();
+			std::sort(d, d + v.size());
+			t.stop();
+			bench::doNotOptimize(d[0]);
+		}
+	}));
+}
+
+BENCH_CASE(algorithm_stable_sort)
+{
+	const long n = report.scaled(200);
+	report.add("algorithm", "stable_sort", "ard_c", n * readingCount, sort_case(n, [](int *d, int s) { ard_c::stableSort(d, d + s); }));
+	report.add("algorithm", "stable_sort", "std", n * readingCount, sort_case(n, [](int *d, int s) { std::stable_sort(d, d + s); }));
+}
+
+BENCH_CASE(algorithm_median)
+{
+	const long n = report.scaled(500);
+	report.add("algorithm", "median", "ard_c", n * readingCount, sort_case(n, [](int *d, int s) { ard_c::nthElement(d, d + s / 2, d + s); }));
+	report.add("algorithm", "median", "std", n * readingCount, sort_case(n, [](int *d, int s) { std::nth_element(d, d + s / 2, d + s); }));
+}
+
+BENCH_CASE(algorithm_lower_bound)
+{
+	const long n = report.scaled(1000000);
+	Vector<int> v;
+	for (int i = 0; i < readingCount; ++i) v.append(i * 3);
+	const int *d = v.constData();
+	report.add("algorithm", "lower_bound", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) sum += lowerBound(v, (int)(i % (readingCount * 3)));
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("algorithm", "lower_bound", "std", n, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) sum += std::lower_bound(d, d + readingCount, (int)(i % (readingCount * 3))) - d;
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
@@ -0,0 +1,175 @@
+#include "Bench.h"
+#include "Vector.h"
+#include "Queue.h"
+
+using namespace ard_c;
+
+
+namespace
+{
+	struct ArenaTag {};
+	struct PoolTag {};
+	typedef ArenaAllocator<ArenaTag> Arena;
+	typedef PoolAllocator<128, PoolTag> Pool;
+
+	alignas(16) unsigned char arenaBuffer[256 * 1024];
+	alignas(16) unsigned char poolBuffer[256 * 1024];
+
+	const int itemCount = 24;
+	const int fragmentationCount = 256;
+
+	template<typename A>
+	void short_lived(bench::Reporter &report, const char *impl)
+	{
+		const long n = report.scaled(200000);
+		report.add("alloc", "vector_short_lived", impl, n, bench::measure([&](bench::Timer &t) {
+			long sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				Vector<int, RefCount, A> v(itemCount);
+				for (int k = 0; k < itemCount; ++k) v.append(k);
+				sum += v.at(itemCount - 1);
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+	}
+
+	// Un "frame" crée plusieurs conteneurs de tailles variées puis les détruit tous.
+	template<typename A>
+	void frame(bench::Reporter &report, const char *impl, bool resetArena)
+	{
+		const long n = report.scaled(20000);
+		const int perFrame = 16;
+		report.add("alloc", "frame_16_vectors", impl, n * perFrame, bench::measure([&](bench::Timer &t) {
+			long sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				{
+					Vector<int, RefCount, A> v[perFrame];
+					for (int k = 0; k < perFrame; ++k)
+					{
+						v[k].reserve(1 + (k * 7) % itemCount);
+						for (int j = 0; j < 1 + (k * 7) % itemCount; ++j) v[k].append(j);
+					}
+					sum += v[perFrame - 1].size();
+				}
+				if (resetArena) Arena::reset();
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+	}
+
+	// Alloue 'count' Vector de tailles variées, en détruit un sur deux, puis mesure
+	// la mémoire consommée par l'allocateur par rapport aux octets réellement vivants.
+	template<typename A>
+	long fragmentation_live(Vector<int, RefCount, A> *v, int count)
+	{
+		for (int k = 0; k < count; ++k)
+		{
+			v[k].reserve(1 + (k * 13) % 32);
+			v[k].append(k);
+		}
+		long live = 0;
+		for (int k = 0; k < count; ++k)
+		{
+			if (k & 1) v[k] = Vector<int, RefCount, A>();
+			else live += v[k].capacity() * (long)sizeof(int) + (long)sizeof(VectorData<int, RefCount, A>);
+		}
+		return live;
+	}
+
+	// Tas avec suivi de l'étendue d'adresses occupée par les blocs alloués.
+	struct SpanHeap
+	{
+		static unsigned char *low;
+		static unsigned char *high;
+		static void track(void *p, size_t bytes)
+		{
+			unsigned char *b = static_cast<unsigned char*>(p);
+			if (!b) return;
+			if (!low || b < low) low = b;
+			if (b + bytes > high) high = b + bytes;
+		}
+		static void *allocate(size_t bytes) { void *p = ::malloc(bytes); track(p, bytes); return p; }
+		static void *reallocate(void *p, size_t, size_t bytes) { void *n = ::realloc(p, bytes); track(n, bytes); return n; }
+		static void deallocate(void *p, size_t) { ::free(p); }
+	};
+	unsigned char *SpanHeap::low = 0;
+	unsigned char *SpanHeap::high = 0;
+
+	template<typename A>
+	void mixed_lifetimes(bench::Reporter &report, const char *impl, long n, bool resetArena)
+	{
+		report.add("alloc", "mixed_lifetimes", impl, n * fragmentationCount, bench::measure([&](bench::Timer &t) {
+			long sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				{
+					Vector<int, RefCount, A> v[fragmentationCount];
+					sum += fragmentation_live(v, fragmentationCount);
+				}
+				if (resetArena) Arena::reset();
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+	}
+
+	void print_fragmentation(const char *impl, long footprint, long live)
+	{
+		fprintf(stderr, "alloc    fragmentation            %-12s footprint=%ld live=%ld waste=%.1f%%\n",
+			impl, footprint, live, footprint ? 100.0 * (footprint - live) / footprint : 0.0);
+	}
+}
+
+
+BENCH_CASE(alloc_latency)
+{
+	Arena::init(arenaBuffer, sizeof(arenaBuffer));
+	Pool::init(poolBuffer, sizeof(poolBuffer));
+
+	short_lived<HeapAllocator>(report, "heap");
+	short_lived<Arena>(report, "arena");
+	short_lived<Pool>(report, "pool");
+
+	frame<HeapAllocator>(report, "heap", false);
+	frame<Arena>(report, "arena", true);
+	frame<Pool>(report, "pool", false);
+}
+
+BENCH_CASE(alloc_fragmentation)
+{
+	const int count = fragmentationCount;
+	{
+		// Étendue d'adresses couverte par les blocs : les trous laissés par les Vector détruits
+		// et les en-têtes de malloc en font partie.
+		Vector<int, RefCount, SpanHeap> *v = new Vector<int, RefCount, SpanHeap>[count];
+		long live = fragmentation_live(v, count);
+		print_fragmentation("heap", (long)(SpanHeap::high - SpanHeap::low), live);
+		delete[] v;
+	}
+	{
+		Arena::init(arenaBuffer, sizeof(arenaBuffer));
+		Vector<int, RefCount, Arena> v[count];
+		long live = fragmentation_live(v, count);
+		print_fragmentation("arena", (long)Arena::used(), live);
+	}
+	Arena::reset();
+	{
+		Pool::init(poolBuffer, sizeof(poolBuffer));
+		Vector<int, RefCount, Pool> v[count];
+		long live = fragmentation_live(v, count);
+		print_fragmentation("pool", (long)(Pool::used() * Pool::blockSize()), live);
+	}
+
+	// Même scénario chronométré, par Vector créé.
+	const long n = report.scaled(200);
+	mixed_lifetimes<HeapAllocator>(report, "heap", n, false);
+	mixed_lifetimes<Arena>(report, "arena", n, true);
+	mixed_lifetimes<Pool>(report, "pool", n, false);
+}
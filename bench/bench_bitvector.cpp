@@ -0,0 +1,157 @@
+#include "Bench.h"
+#include "BitVector.h"
+
+#include <vector>
+
+using namespace ard_c;
+
+
+namespace
+{
+	// Carte de défauts de 4096 voies, environ une voie sur 16 active.
+	const int Channels = 4096;
+
+	bool channel_fault(int i) { return ((unsigned)i * 2654435761u >> 28) == 0; }
+}
+
+
+BENCH_CASE(bitvector_count)
+{
+	const long n = report.scaled(20000);
+	Vector<bool> v;
+	BitVector<> b;
+	std::vector<bool> s;
+	for (int i = 0; i < Channels; ++i)
+	{
+		v.append(channel_fault(i));
+		b.append(channel_fault(i));
+		s.push_back(channel_fault(i));
+	}
+	const Vector<bool> &cv = v;
+	report.add("bitvector", "count_4096", "vector_bool", n, bench::measure([&](bench::Timer &t) {
+		long c = 0;
+		t.start();
+		for (long r = 0; r < n; ++r)
+		{
+			const bool *p = cv.constData();
+			for (int i = 0; i < Channels; ++i) c += p[i];
+			bench::doNotOptimize(c);
+		}
+		t.stop();
+	}));
+	report.add("bitvector", "count_4096", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		long c = 0;
+		t.start();
+		for (long r = 0; r < n; ++r)
+		{
+			c += b.count();
+			bench::doNotOptimize(c);
+		}
+		t.stop();
+	}));
+	report.add("bitvector", "count_4096", "std", n, bench::measure([&](bench::Timer &t) {
+		long c = 0;
+		t.start();
+		for (long r = 0; r < n; ++r)
+		{
+			for (int i = 0; i < Channels; ++i) c += s[i];
+			bench::doNotOptimize(c);
+		}
+		t.stop();
+	}));
+}
+
+BENCH_CASE(bitvector_find_set)
+{
+	// Parcours des voies en défaut.
+	const long n = report.scaled(20000);
+	Vector<bool> v;
+	BitVector<> b;
+	std::vector<bool> s;
+	for (int i = 0; i < Channels; ++i)
+	{
+		v.append(channel_fault(i));
+		b.append(channel_fault(i));
+		s.push_back(channel_fault(i));
+	}
+	const Vector<bool> &cv = v;
+	report.add("bitvector", "find_set_4096", "vector_bool", n, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long r = 0; r < n; ++r)
+		{
+			const bool *p = cv.constData();
+			for (int i = 0; i < Channels; ++i)
+				if (p[i]) sum += i;
+			bench::doNotOptimize(sum);
+		}
+		t.stop();
+	}));
+	report.add("bitvector", "find_set_4096", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long r = 0; r < n; ++r)
+		{
+			for (int i = b.findFirstSet(); i != -1; i = b.findNextSet(i)) sum += i;
+			bench::doNotOptimize(sum);
+		}
+		t.stop();
+	}));
+	report.add("bitvector", "find_set_4096", "std", n, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long r = 0; r < n; ++r)
+		{
+			for (int i = 0; i < Channels; ++i)
+				if (s[i]) sum += i;
+			bench::doNotOptimize(sum);
+		}
+		t.stop();
+	}));
+}
+
+BENCH_CASE(bitvector_mask)
+{
+	// Voies actives et sans défaut : enable &= ~fault.
+	const long n = report.scaled(20000);
+	Vector<bool> ve, vf;
+	BitVector<> be(Channels, true), bf;
+	std::vector<bool> se(Channels, true), sf;
+	for (int i = 0; i < Channels; ++i)
+	{
+		ve.append(true);
+		vf.append(channel_fault(i));
+		bf.append(channel_fault(i));
+		sf.push_back(channel_fault(i));
+	}
+	const Vector<bool> &cvf = vf;
+	report.add("bitvector", "and_not_4096", "vector_bool", n, bench::measure([&](bench::Timer &t) {
+		t.start();
+		for (long r = 0; r < n; ++r)
+		{
+			bool *e = ve.data();
+			const bool *f = cvf.constData();
+			for (int i = 0; i < Channels; ++i) e[i] = e[i] && !f[i];
+			bench::doNotOptimize(e);
+		}
+		t.stop();
+	}));
+	report.add("bitvector", "and_not_4096", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		t.start();
+		for (long r = 0; r < n; ++r)
+		{
+			be.andNot(bf);
+			bench::doNotOptimize(be.size());
+		}
+		t.stop();
+	}));
+	report.add("bitvector", "and_not_4096", "std", n, bench::measure([&](bench::Timer &t) {
+		t.start();
+		for (long r = 0; r < n; ++r)
+		{
+			for (int i = 0; i < Channels; ++i) se[i] = se[i] && !sf[i];
+			bench::doNotOptimize(se.size());
+		}
+		t.stop();
+	}));
+}
@@ -0,0 +1,139 @@
+#include "Bench.h"
+#include "Stack.h"
+#include "ChunkedStack.h"
+
+#include <vector>
+
+using namespace ard_c;
+
+
+namespace
+{
+	// Pile d'états d'un analyseur : quelques mots par entrée.
+	struct State
+	{
+		int rule;
+		int token;
+		const char *pos;
+	};
+
+	State make_state(long i)
+	{
+		State s = { (int)i, (int)(i * 7), 0 };
+		return s;
+	}
+
+	struct VectorStack
+	{
+		std::vector<State> v;
+		void push(const State &s) { v.push_back(s); }
+		int size() const { return (int)v.size(); }
+	};
+
+	// Latence des push() isolés sur une pile remplie à 'n' éléments : la pire, et le nombre de
+	// push() de plus d'une microseconde ( réallocations, pour l'essentiel ).
+	struct Latency
+	{
+		double worst;
+		long slow;
+	};
+
+	template<typename S>
+	Latency push_latency(long n)
+	{
+		S s;
+		Latency l = { 0, 0 };
+		for (long i = 0; i < n; ++i)
+		{
+			double t0 = bench::now();
+			s.push(make_state(i));
+			double t = bench::now() - t0;
+			if (t > l.worst) l.worst = t;
+			if (t > 1e-6) ++l.slow;
+		}
+		bench::doNotOptimize(s.size());
+		l.worst *= 1e9;
+		return l;
+	}
+}
+
+
+BENCH_CASE(chunked_stack_fill_drain)
+{
+	const long n = report.scaled(200000);
+	report.add("chunked_stack", "fill_drain", "stack", n, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		Stack<State> s;
+		for (long i = 0; i < n; ++i) s.push(make_state(i));
+		while (!s.isEmpty()) sum += s.pop().rule;
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("chunked_stack", "fill_drain", "chunked_stack", n, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		ChunkedStack<State> s;
+		for (long i = 0; i < n; ++i) s.push(make_state(i));
+		while (!s.isEmpty()) sum += s.pop().rule;
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("chunked_stack", "fill_drain", "std_vector", n, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		std::vector<State> s;
+		for (long i = 0; i < n; ++i) s.push_back(make_state(i));
+		while (!s.empty())
+		{
+			sum += s.back().rule;
+			s.pop_back();
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
+
+BENCH_CASE(chunked_stack_boundary)
+{
+	// Profondeur qui oscille autour d'une frontière de bloc : le bloc de réserve évite une
+	// allocation et une libération à chaque aller-retour.
+	const long n = report.scaled(2000000);
+	const int depth = ChunkCapacity<State>::value;
+	report.add("chunked_stack", "boundary_push_pop", "stack", n, bench::measure([&](bench::Timer &t) {
+		Stack<State> s;
+		for (int i = 0; i < depth; ++i) s.push(make_state(i));
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			s.push(make_state(i));
+			sum += s.pop().token;
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("chunked_stack", "boundary_push_pop", "chunked_stack", n, bench::measure([&](bench::Timer &t) {
+		ChunkedStack<State> s;
+		for (int i = 0; i < depth; ++i) s.push(make_state(i));
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			s.push(make_state(i));
+			sum += s.pop().token;
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
+
+BENCH_CASE(chunked_stack_push_latency)
+{
+	const long n = report.scaled(1000000);
+	Latency stack = push_latency<Stack<State> >(n);
+	Latency chunked = push_latency<ChunkedStack<State> >(n);
+	Latency vector = push_latency<VectorStack>(n);
+	fprintf(stderr, "chunked_stack push_latency_%ld  worst ns ( pushes > 1us ) : stack=%.0f (%ld) chunked_stack=%.0f (%ld) std_vector=%.0f (%ld)\n",
+		n, stack.worst, stack.slow, chunked.worst, chunked.slow, vector.worst, vector.slow);
+}
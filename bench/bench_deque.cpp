@@ -0,0 +1,210 @@
+#include "Bench.h"
+#include "Deque.h"
+
+#include <deque>
+
+using namespace ard_c;
+
+
+BENCH_CASE(deque_prepend)
+{
+	const long n = report.scaled(200000);
+	report.add("deque", "prepend", "vector", n / 10, bench::measure([&](bench::Timer &t) {
+		// Vector::prepend décale tout le contenu : on se limite à n / 10 éléments.
+		Vector<int> v;
+		t.start();
+		for (long i = 0; i < n / 10; ++i) v.prepend((int)i);
+		t.stop();
+		bench::doNotOptimize(v.size());
+	}));
+	report.add("deque", "prepend", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		Deque<int> d;
+		t.start();
+		for (long i = 0; i < n; ++i) d.prepend((int)i);
+		t.stop();
+		bench::doNotOptimize(d.size());
+	}));
+	report.add("deque", "prepend", "std", n, bench::measure([&](bench::Timer &t) {
+		std::deque<int> d;
+		t.start();
+		for (long i = 0; i < n; ++i) d.push_front((int)i);
+		t.stop();
+		bench::doNotOptimize(d.size());
+	}));
+}
+
+BENCH_CASE(deque_fifo)
+{
+	// File de 1000 éléments en régime permanent : un ajout en fin, un retrait en tête.
+	const long n = report.scaled(1000000);
+	const int window = 1000;
+	report.add("deque", "fifo_1000", "vector", n / 10, bench::measure([&](bench::Timer &t) {
+		Vector<int> v;
+		for (int i = 0; i < window; ++i) v.append(i);
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n / 10; ++i)
+		{
+			v.append((int)i);
+			sum += v.takeFirst();
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("deque", "fifo_1000", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		Deque<int> d;
+		for (int i = 0; i < window; ++i) d.append(i);
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			d.append((int)i);
+			sum += d.takeFirst();
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("deque", "fifo_1000", "std", n, bench::measure([&](bench::Timer &t) {
+		std::deque<int> d;
+		for (int i = 0; i < window; ++i) d.push_back(i);
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			d.push_back((int)i);
+			sum += d.front();
+			d.pop_front();
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
+
+BENCH_CASE(deque_both_ends)
+{
+	// Ajouts et retraits alternés aux deux extrémités ( file de travail à vol ).
+	const long n = report.scaled(1000000);
+	report.add("deque", "both_ends", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		Deque<int> d;
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			if (i & 1) d.prepend((int)i);
+			else d.append((int)i);
+			if ((i & 3) == 3) sum += d.takeFirst() + d.takeLast();
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("deque", "both_ends", "std", n, bench::measure([&](bench::Timer &t) {
+		std::deque<int> d;
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			if (i & 1) d.push_front((int)i);
+			else d.push_back((int)i);
+			if ((i & 3) == 3)
+			{
+				sum += d.front() + d.back();
+				d.pop_front();
+				d.pop_back();
+			}
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
+
+BENCH_CASE(deque_random_access)
+{
+	const int size = 100000;
+	const long n = report.scaled(10000000);
+	Deque<int> d;
+	std::deque<int> s;
+	for (int i = 0; i < size; ++i)
+	{
+		if (i & 1) { d.prepend(i); s.push_front(i); }
+		else { d.append(i); s.push_back(i); }
+	}
+	const Deque<int> &cd = d;
+	report.add("deque", "random_access", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		unsigned idx = 1;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			idx = idx * 1103515245u + 12345u;
+			sum += cd.at((int)(idx % size));
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("deque", "random_access", "std", n, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		unsigned idx = 1;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			idx = idx * 1103515245u + 12345u;
+			sum += s[idx % size];
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("deque", "scan", "ard_c", (long)size * 100, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (int r = 0; r < 100; ++r)
+			for (Deque<int>::ConstIterator it = cd.constBegin(); it != cd.constEnd(); ++it) sum += *it;
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("deque", "scan", "std", (long)size * 100, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (int r = 0; r < 100; ++r)
+			for (std::deque<int>::const_iterator it = s.begin(); it != s.end(); ++it) sum += *it;
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
+
+BENCH_CASE(deque_append_range)
+{
+	// Tampon de réception : blocs de 56 éléments ajoutés d'un coup, consommés un par un en tête.
+	// Le début du buffer n'est pas à 0 quand append( range ) réalloue.
+	const long n = report.scaled(1000000);
+	const int block = 56;
+	int src[block];
+	for (int i = 0; i < block; ++i) src[i] = i;
+	report.add("deque", "append_range_56", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		Deque<int> d;
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; i += block)
+		{
+			d.append(src, block);
+			for (int k = 0; k < block - 8 && !d.isEmpty(); ++k) sum += d.takeFirst();
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("deque", "append_range_56", "std", n, bench::measure([&](bench::Timer &t) {
+		std::deque<int> d;
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; i += block)
+		{
+			d.insert(d.end(), src, src + block);
+			for (int k = 0; k < block - 8 && !d.empty(); ++k)
+			{
+				sum += d.front();
+				d.pop_front();
+			}
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
@@ -0,0 +1,74 @@
+#include "Bench.h"
+#include "Vector.h"
+#include "Queue.h"
+
+using namespace ard_c;
+
+
+// Parcours d'un conteneur partagé : begin() non constant provoque une deep copy,
+// constBegin() et asConst() lisent directement la data partagée.
+BENCH_CASE(detach)
+{
+	const long size = report.scaled(1000);
+	const long n = report.scaled(10000);
+	Vector<int> src(size);
+	for (long i = 0; i < size; ++i) src.append((int)i);
+	Queue<int> qsrc;
+	for (long i = 0; i < size; ++i) qsrc.enqueue((int)i);
+
+	report.add("detach", "vector_iterate_shared", "begin", n * size, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			Vector<int> c(src);
+			for (Vector<int>::Iterator it = c.begin(); it != c.end(); ++it) sum += *it;
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("detach", "vector_iterate_shared", "constBegin", n * size, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			Vector<int> c(src);
+			for (Vector<int>::ConstIterator it = c.constBegin(); it != c.constEnd(); ++it) sum += *it;
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("detach", "vector_range_for_shared", "asConst", n * size, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			Vector<int> c(src);
+			for (int v : asConst(c)) sum += v;
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("detach", "queue_iterate_shared", "begin", n * size, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			Queue<int> c(qsrc);
+			for (Queue<int>::Iterator it = c.begin(); it != c.end(); ++it) sum += *it;
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("detach", "queue_iterate_shared", "constRange", n * size, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			Queue<int> c(qsrc);
+			for (int v : c.constRange()) sum += v;
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
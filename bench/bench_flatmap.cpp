@@ -0,0 +1,132 @@
+#include "Bench.h"
+#include "FlatMap.h"
+
+#include <map>
+#include <stdlib.h>
+
+using namespace ard_c;
+
+
+namespace
+{
+	// Table de paramètres : quelques centaines d'identifiants 16 bits.
+	const int paramCount = 300;
+
+	struct Pair
+	{
+		uint16_t key;
+		float value;
+	};
+
+	uint16_t param_key(int i) { return (uint16_t)(i * 37 + 11); }
+}
+
+
+BENCH_CASE(flatmap_lookup)
+{
+	const long n = report.scaled(2000000);
+
+	Vector<Pair> pairs;
+	FlatMap<uint16_t, float> flat;
+	std::map<uint16_t, float> tree;
+	for (int i = 0; i < paramCount; ++i)
+	{
+		Pair p = { param_key(i), (float)i };
+		pairs.append(p);
+		flat.insert(p.key, p.value);
+		tree[p.key] = p.value;
+	}
+
+	// Clés interrogées dans un ordre pseudo aléatoire, hors chrono.
+	Vector<uint16_t> queries;
+	srand(3);
+	for (int i = 0; i < 4096; ++i) queries.append(param_key(rand() % paramCount));
+	const uint16_t *q = queries.constData();
+
+	report.add("flatmap", "lookup_300", "linear_scan", n, bench::measure([&](bench::Timer &t) {
+		float sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			uint16_t key = q[i & 4095];
+			for (int j = 0; j < pairs.size(); ++j)
+			{
+				if (pairs.at(j).key == key)
+				{
+					sum += pairs.at(j).value;
+					break;
+				}
+			}
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("flatmap", "lookup_300", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		float sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) sum += *flat.find(q[i & 4095]);
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("flatmap", "lookup_300", "std_map", n, bench::measure([&](bench::Timer &t) {
+		float sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) sum += tree.find(q[i & 4095])->second;
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+
+	fprintf(stderr, "flatmap  footprint_300            ard_c=%ld std_map~%ld bytes\n",
+		(long)(flat.capacity() * (sizeof(uint16_t) + sizeof(float)) + 2 * sizeof(VectorData<int>)),
+		(long)(tree.size() * (sizeof(std::map<uint16_t, float>::value_type) + 4 * sizeof(void*))));
+}
+
+BENCH_CASE(flatmap_build)
+{
+	const long n = report.scaled(2000);
+	uint16_t keys[paramCount];
+	float values[paramCount];
+	srand(5);
+	for (int i = 0; i < paramCount; ++i)
+	{
+		keys[i] = param_key(rand() % 1000);
+		values[i] = (float)i;
+	}
+
+	report.add("flatmap", "build_300", "insert", n * paramCount, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			FlatMap<uint16_t, float> m;
+			for (int j = 0; j < paramCount; ++j) m.insert(keys[j], values[j]);
+			sum += m.size();
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("flatmap", "build_300", "insert_unsorted", n * paramCount, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			FlatMap<uint16_t, float> m;
+			m.insertUnsorted(keys, values, paramCount);
+			sum += m.size();
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("flatmap", "build_300", "std_map", n * paramCount, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			std::map<uint16_t, float> m;
+			for (int j = 0; j < paramCount; ++j) m[keys[j]] = values[j];
+			sum += (long)m.size();
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
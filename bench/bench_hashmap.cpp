@@ -0,0 +1,149 @@
+#include "Bench.h"
+#include "HashMap.h"
+#include "FlatMap.h"
+
+#include <unordered_map>
+#include <stdlib.h>
+
+using namespace ard_c;
+
+
+namespace
+{
+	// Identifiants de périphériques : 32 bits, répartis sans ordre particulier.
+	void make_ids(Vector<uint32_t> &ids, int count, unsigned seed)
+	{
+		srand(seed);
+		ids.clear();
+		for (int i = 0; i < count; ++i) ids.append(((uint32_t)rand() << 8) ^ (uint32_t)i);
+	}
+
+	void registry(bench::Reporter &report, int count, const char *insertName, const char *lookupName, const char *eraseName)
+	{
+		const long n = report.scaled(4000000 / count);
+		Vector<uint32_t> ids;
+		make_ids(ids, count, 11);
+		const uint32_t *id = ids.constData();
+
+		report.add("hashmap", insertName, "ard_c", n * count, bench::measure([&](bench::Timer &t) {
+			long sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				HashMap<uint32_t, int> m;
+				for (int k = 0; k < count; ++k) m.insert(id[k], k);
+				sum += m.size();
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+		report.add("hashmap", insertName, "ard_c_reserved", n * count, bench::measure([&](bench::Timer &t) {
+			long sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				HashMap<uint32_t, int> m(count);
+				for (int k = 0; k < count; ++k) m.insert(id[k], k);
+				sum += m.size();
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+		report.add("hashmap", insertName, "std", n * count, bench::measure([&](bench::Timer &t) {
+			long sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				std::unordered_map<uint32_t, int> m;
+				for (int k = 0; k < count; ++k) m[id[k]] = k;
+				sum += (long)m.size();
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+		report.add("hashmap", insertName, "flatmap", report.scaled(4000000 / count / (count / 100)) * count, bench::measure([&](bench::Timer &t) {
+			long sum = 0;
+			const long rounds = report.scaled(4000000 / count / (count / 100));
+			t.start();
+			for (long i = 0; i < rounds; ++i)
+			{
+				FlatMap<uint32_t, int> m;
+				for (int k = 0; k < count; ++k) m.insert(id[k], k);
+				sum += m.size();
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+
+		// Recherches dans un ordre aléatoire : moitié de clés présentes, moitié absentes.
+		Vector<uint32_t> queries;
+		make_ids(queries, count, 12);
+		uint32_t *query = queries.data();
+		for (int k = 0; k < count; k += 2) query[k] = id[k];
+		for (int k = count - 1; k > 0; --k) ard_c::swap(query[k], query[rand() % (k + 1)]);
+		HashMap<uint32_t, int> m;
+		std::unordered_map<uint32_t, int> s;
+		for (int k = 0; k < count; ++k)
+		{
+			m.insert(id[k], k);
+			s[id[k]] = k;
+		}
+		report.add("hashmap", lookupName, "ard_c", n * count, bench::measure([&](bench::Timer &t) {
+			long sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+				for (int k = 0; k < count; ++k) sum += m.value(query[k], -1);
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+		report.add("hashmap", lookupName, "std", n * count, bench::measure([&](bench::Timer &t) {
+			long sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				for (int k = 0; k < count; ++k)
+				{
+					std::unordered_map<uint32_t, int>::const_iterator it = s.find(query[k]);
+					sum += it == s.end() ? -1 : it->second;
+				}
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+
+		// Suppression de toutes les clés, table remplie hors chrono.
+		report.add("hashmap", eraseName, "ard_c", n * count, bench::measure([&](bench::Timer &t) {
+			long sum = 0;
+			for (long i = 0; i < n; ++i)
+			{
+				HashMap<uint32_t, int> e(m);
+				t.start();
+				for (int k = 0; k < count; ++k) sum += e.remove(id[k]);
+				t.stop();
+			}
+			bench::doNotOptimize(sum);
+		}));
+		report.add("hashmap", eraseName, "std", n * count, bench::measure([&](bench::Timer &t) {
+			long sum = 0;
+			for (long i = 0; i < n; ++i)
+			{
+				std::unordered_map<uint32_t, int> e(s);
+				t.start();
+				for (int k = 0; k < count; ++k) sum += (long)e.erase(id[k]);
+				t.stop();
+			}
+			bench::doNotOptimize(sum);
+		}));
+	}
+}
+
+
+BENCH_CASE(hashmap_1k)
+{
+	registry(report, 1000, "insert_1k", "lookup_1k", "erase_1k");
+}
+
+BENCH_CASE(hashmap_10k)
+{
+	registry(report, 10000, "insert_10k", "lookup_10k", "erase_10k");
+}
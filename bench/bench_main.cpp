@@ -0,0 +1,110 @@
+#include "Bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+namespace bench
+{
+	Reporter::~Reporter()
+	{
+		free(_results);
+	}
+
+	void Reporter::add(const char *suite, const char *name, const char *impl, long n, double seconds)
+	{
+		if (_count == _capacity)
+		{
+			_capacity = _capacity ? _capacity * 2 : 32;
+			_results = (Result*)realloc(_results, sizeof(Result) * _capacity);
+			if (!_results) abort();
+		}
+		Result r = { suite, name, impl, n, seconds * 1e9 / (double)n };
+		_results[_count++] = r;
+		fprintf(stderr, "%-8s %-24s %-12s n=%-8ld %10.2f ns/op\n", suite, name, impl, n, r.nsPerOp);
+	}
+
+	void Reporter::writeCsv(FILE *out) const
+	{
+		fprintf(out, "suite,case,impl,n,ns_per_op,mops\n");
+		for (int i = 0; i < _count; ++i)
+		{
+			const Result &r = _results[i];
+			fprintf(out, "%s,%s,%s,%ld,%.3f,%.3f\n", r.suite, r.name, r.impl, r.n, r.nsPerOp, 1e3 / r.nsPerOp);
+		}
+	}
+
+	void Reporter::writeJson(FILE *out) const
+	{
+		fprintf(out, "{\n  \"compiler\": \"%s\",\n  \"results\": [\n", __VERSION__);
+		for (int i = 0; i < _count; ++i)
+		{
+			const Result &r = _results[i];
+			fprintf(out, "    { \"suite\": \"%s\", \"case\": \"%s\", \"impl\": \"%s\", \"n\": %ld, \"ns_per_op\": %.3f, \"mops\": %.3f }%s\n",
+				r.suite, r.name, r.impl, r.n, r.nsPerOp, 1e3 / r.nsPerOp, i + 1 < _count ? "," : "");
+		}
+		fprintf(out, "  ]\n}\n");
+	}
+
+
+	Case::Case(const char *n, CaseFn f) : name(n), fn(f), next(0)
+	{
+		// Conserve l'ordre de déclaration à l'intérieur d'un même fichier.
+		Case **c = &head();
+		while (*c) c = &(*c)->next;
+		*c = this;
+	}
+
+	Case *&Case::head()
+	{
+		static Case *h = 0;
+		return h;
+	}
+}
+
+
+static void usage(const char *argv0)
+{
+	fprintf(stderr,
+		"usage: %s [--format=csv|json] [--out=FILE] [--filter=TEXT] [--scale=X] [--list]\n"
+		"  --format  format des résultats ( csv par défaut ), écrit sur stdout ou FILE\n"
+		"  --filter  n'exécute que les cas dont le nom contient TEXT\n"
+		"  --scale   multiplie les tailles de travail ( 0.1 pour un passage rapide )\n",
+		argv0);
+}
+
+int main(int argc, char **argv)
+{
+	const char *format = "csv";
+	const char *outPath = 0;
+	const char *filter = 0;
+	bool list = false;
+	bench::Reporter report;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const char *a = argv[i];
+		if (!strncmp(a, "--format=", 9)) format = a + 9;
+		else if (!strncmp(a, "--out=", 6)) outPath = a + 6;
+		else if (!strncmp(a, "--filter=", 9)) filter = a + 9;
+		else if (!strncmp(a, "--scale=", 8)) report.setScale(atof(a + 8));
+		else if (!strcmp(a, "--list")) list = true;
+		else { usage(argv[0]); return 2; }
+	}
+	if (strcmp(format, "csv") && strcmp(format, "json")) { usage(argv[0]); return 2; }
+
+	for (bench::Case *c = bench::Case::head(); c; c = c->next)
+	{
+		if (filter && !strstr(c->name, filter)) continue;
+		if (list) { printf("%s\n", c->name); continue; }
+		c->fn(report);
+	}
+	if (list) return 0;
+
+	FILE *out = outPath ? fopen(outPath, "w") : stdout;
+	if (!out) { perror(outPath); return 1; }
+	if (!strcmp(format, "json")) report.writeJson(out);
+	else report.writeCsv(out);
+	if (out != stdout) fclose(out);
+	return 0;
+}
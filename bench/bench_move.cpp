@@ -0,0 +1,88 @@
+#include "Bench.h"
+#include "Vector.h"
+#include "Queue.h"
+#include "Stack.h"
+
+using namespace ard_c;
+
+
+namespace
+{
+	// Message possédant un payload sur le tas, comme nos trames série.
+	struct Message
+	{
+		char *payload;
+		int len;
+
+		Message(int l) : payload((char*)malloc(l)), len(l) { memset(payload, 0, l); }
+		Message(const Message &o) : payload((char*)malloc(o.len)), len(o.len) { memcpy(payload, o.payload, len); }
+		Message(Message &&o) : payload(o.payload), len(o.len) { o.payload = 0; o.len = 0; }
+		~Message() { free(payload); }
+	};
+}
+
+
+BENCH_CASE(move_vector_append)
+{
+	const long n = report.scaled(100000);
+	report.add("move", "vector_append", "copy", n, bench::measure([&](bench::Timer &t) {
+		Vector<Message> v(n);
+		t.start();
+		for (long i = 0; i < n; ++i) { Message m(32); v.append(m); }
+		t.stop();
+	}));
+	report.add("move", "vector_append", "move", n, bench::measure([&](bench::Timer &t) {
+		Vector<Message> v(n);
+		t.start();
+		for (long i = 0; i < n; ++i) { Message m(32); v.append(ard_c::move(m)); }
+		t.stop();
+	}));
+	report.add("move", "vector_append", "emplace", n, bench::measure([&](bench::Timer &t) {
+		Vector<Message> v(n);
+		t.start();
+		for (long i = 0; i < n; ++i) v.emplaceBack(32);
+		t.stop();
+	}));
+}
+
+BENCH_CASE(move_queue_roundtrip)
+{
+	const long n = report.scaled(100000);
+	report.add("move", "queue_roundtrip", "copy", n, bench::measure([&](bench::Timer &t) {
+		Queue<Message> q;
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) { Message m(32); q.enqueue(m); sum += q.dequeue().len; }
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("move", "queue_roundtrip", "emplace", n, bench::measure([&](bench::Timer &t) {
+		Queue<Message> q;
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) { q.emplaceEnqueue(32); sum += q.dequeue().len; }
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
+
+BENCH_CASE(move_stack_push_pop)
+{
+	const long n = report.scaled(100000);
+	report.add("move", "stack_push_pop", "copy", n, bench::measure([&](bench::Timer &t) {
+		Stack<Message> s;
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) { Message m(32); s.push(m); sum += s.pop().len; }
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("move", "stack_push_pop", "move", n, bench::measure([&](bench::Timer &t) {
+		Stack<Message> s;
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) { Message m(32); s.push(ard_c::move(m)); sum += s.pop().len; }
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
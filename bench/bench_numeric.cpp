@@ -0,0 +1,104 @@
+#include "Bench.h"
+#include "Numeric.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdlib.h>
+
+using namespace ard_c;
+
+
+namespace
+{
+	// Fenêtre d'échantillons traitée à chaque cycle.
+	const int windowSize = 2048;
+
+	template<typename T>
+	Vector<T> window()
+	{
+		Vector<T> v;
+		srand(7);
+		for (int i = 0; i < windowSize; ++i) v.append((T)(rand() % 2000 - 1000));
+		return v;
+	}
+
+	template<typename T, typename F>
+	double run(long n, const Vector<T> &v, F f)
+	{
+		return bench::measure([&](bench::Timer &t) {
+			double acc = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				acc += f(v);
+				bench::clobber();
+			}
+			t.stop();
+			bench::doNotOptimize(acc);
+		});
+	}
+
+	// Boucles actuelles : parcours par at(), avec son contrôle d'index.
+	template<typename T>
+	void reductions(bench::Reporter &report, const char *suite)
+	{
+		const long n = report.scaled(20000);
+		const long ops = n * windowSize;
+		const Vector<T> v = window<T>();
+		const T *d = v.constData();
+		const T needle = v.at(windowSize - 3);
+
+		report.add(suite, "sum", "at_loop", ops, run(n, v, [](const Vector<T> &w) {
+			typename sum_type<T>::type s = 0;
+			for (int i = 0; i < w.size(); ++i) s += w.at(i);
+			return (double)s;
+		}));
+		report.add(suite, "sum", "ard_c", ops, run(n, v, [](const Vector<T> &w) { return (double)sum(w); }));
+		report.add(suite, "sum", "std", ops, run(n, v, [d](const Vector<T> &) {
+			return (double)std::accumulate(d, d + windowSize, (typename sum_type<T>::type)0);
+		}));
+
+		report.add(suite, "min_max", "at_loop", ops, run(n, v, [](const Vector<T> &w) {
+			T lo = w.at(0), hi = w.at(0);
+			for (int i = 1; i < w.size(); ++i)
+			{
+				if (w.at(i) < lo) lo = w.at(i);
+				if (hi < w.at(i)) hi = w.at(i);
+			}
+			return (double)hi - lo;
+		}));
+		report.add(suite, "min_max", "ard_c", ops, run(n, v, [](const Vector<T> &w) {
+			MinMax<T> r = minMax(w);
+			return (double)r.max - r.min;
+		}));
+		report.add(suite, "min_max", "std", ops, run(n, v, [d](const Vector<T> &) {
+			std::pair<const T*, const T*> r = std::minmax_element(d, d + windowSize);
+			return (double)*r.second - *r.first;
+		}));
+
+		report.add(suite, "index_of", "at_loop", ops, run(n, v, [needle](const Vector<T> &w) {
+			for (int i = 0; i < w.size(); ++i) if (w.at(i) == needle) return (double)i;
+			return -1.0;
+		}));
+		report.add(suite, "index_of", "ard_c", ops, run(n, v, [needle](const Vector<T> &w) { return (double)indexOf(w, needle); }));
+		report.add(suite, "index_of", "std", ops, run(n, v, [d, needle](const Vector<T> &) {
+			return (double)(std::find(d, d + windowSize, needle) - d);
+		}));
+
+		report.add(suite, "count", "ard_c", ops, run(n, v, [needle](const Vector<T> &w) { return (double)count(w, needle); }));
+		report.add(suite, "count", "std", ops, run(n, v, [d, needle](const Vector<T> &) {
+			return (double)std::count(d, d + windowSize, needle);
+		}));
+	}
+}
+
+
+BENCH_CASE(numeric_int16)
+{
+	reductions<int16_t>(report, "numeric_int16");
+}
+
+BENCH_CASE(numeric_float)
+{
+	reductions<float>(report, "numeric_float");
+}
@@ -0,0 +1,195 @@
+#include "Bench.h"
+#include "PriorityQueue.h"
+
+#include <queue>
+#include <vector>
+#include <stdlib.h>
+
+using namespace ard_c;
+
+
+namespace
+{
+	struct Timer
+	{
+		uint32_t deadline;
+		uint16_t id;
+		bool operator<(const Timer &other) const { return deadline < other.deadline; }
+	};
+
+	struct TimerLater
+	{
+		bool operator()(const Timer &a, const Timer &b) const { return b.deadline < a.deadline; }
+	};
+
+	// Délais de réarmement tirés à l'avance, hors chrono.
+	const int delayCount = 4096;
+	uint32_t delays[delayCount];
+
+	void make_delays()
+	{
+		srand(7);
+		for (int i = 0; i < delayCount; ++i) delays[i] = 1 + (uint32_t)(rand() % 5000);
+	}
+
+	Timer timer_at(int i)
+	{
+		Timer t = { delays[i % delayCount], (uint16_t)i };
+		return t;
+	}
+
+	// Ordonnanceur : on déclenche la minuterie la plus proche puis on la réarme, avec
+	// 'pending' minuteries en attente.
+	void bench_schedule_fire(bench::Reporter &report, const char *name, int pending, long n)
+	{
+		report.add("priority_queue", name, "sorted_vector", n, bench::measure([&](bench::Timer &t) {
+			// Approche actuelle : Vector trié par échéance décroissante, la plus proche en fin.
+			Vector<Timer> v(pending + 1);
+			for (int i = 0; i < pending; ++i) v.insert(timer_at(i), upperBound(v, timer_at(i), Greater<Timer>()));
+			uint32_t sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				Timer fired = v.takeLast();
+				sum += fired.id;
+				fired.deadline += delays[i & (delayCount - 1)];
+				v.insert(fired, upperBound(v, fired, Greater<Timer>()));
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+		report.add("priority_queue", name, "std_priority_queue", n, bench::measure([&](bench::Timer &t) {
+			std::priority_queue<Timer, std::vector<Timer>, TimerLater> q;
+			for (int i = 0; i < pending; ++i) q.push(timer_at(i));
+			uint32_t sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				Timer fired = q.top();
+				q.pop();
+				sum += fired.id;
+				fired.deadline += delays[i & (delayCount - 1)];
+				q.push(fired);
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+		report.add("priority_queue", name, "ard_c_binary", n, bench::measure([&](bench::Timer &t) {
+			PriorityQueue<Timer, Less<Timer>, 2> q(pending + 1);
+			for (int i = 0; i < pending; ++i) q.push(timer_at(i));
+			uint32_t sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				Timer fired = q.pop();
+				sum += fired.id;
+				fired.deadline += delays[i & (delayCount - 1)];
+				q.push(fired);
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+		report.add("priority_queue", name, "ard_c_4ary", n, bench::measure([&](bench::Timer &t) {
+			PriorityQueue<Timer, Less<Timer>, 4> q(pending + 1);
+			for (int i = 0; i < pending; ++i) q.push(timer_at(i));
+			uint32_t sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				Timer fired = q.pop();
+				sum += fired.id;
+				fired.deadline += delays[i & (delayCount - 1)];
+				q.push(fired);
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+		report.add("priority_queue", name, "ard_c_4ary_replace_top", n, bench::measure([&](bench::Timer &t) {
+			PriorityQueue<Timer, Less<Timer>, 4> q(pending + 1);
+			for (int i = 0; i < pending; ++i) q.push(timer_at(i));
+			uint32_t sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				Timer rearmed = q.top();
+				sum += rearmed.id;
+				rearmed.deadline += delays[i & (delayCount - 1)];
+				q.replaceTop(rearmed);
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+		report.add("priority_queue", name, "ard_c_indexed_4ary", n, bench::measure([&](bench::Timer &t) {
+			IndexedPriorityQueue<Timer, Less<Timer>, 4> q(pending + 1);
+			for (int i = 0; i < pending; ++i) q.push(timer_at(i));
+			uint32_t sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				Timer fired = q.pop();
+				sum += fired.id;
+				fired.deadline += delays[i & (delayCount - 1)];
+				q.push(fired);
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+	}
+
+	// Report d'une minuterie en attente ( délai de garde repoussé ) : recherche, retrait et
+	// réinsertion dans le Vector trié, contre update() sur un handle.
+	void bench_reschedule(bench::Reporter &report, const char *name, int pending, long n)
+	{
+		report.add("priority_queue", name, "sorted_vector", n, bench::measure([&](bench::Timer &t) {
+			Vector<Timer> v(pending + 1);
+			for (int i = 0; i < pending; ++i) v.insert(timer_at(i), upperBound(v, timer_at(i), Greater<Timer>()));
+			uint32_t sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				uint16_t id = (uint16_t)((i * 7919) % pending);
+				int j = 0;
+				while (v.at(j).id != id) ++j;
+				Timer moved = v.take(j);
+				moved.deadline += delays[i & (delayCount - 1)];
+				v.insert(moved, upperBound(v, moved, Greater<Timer>()));
+				sum += v.last().id;
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+		report.add("priority_queue", name, "ard_c_indexed_4ary", n, bench::measure([&](bench::Timer &t) {
+			IndexedPriorityQueue<Timer, Less<Timer>, 4> q(pending + 1);
+			for (int i = 0; i < pending; ++i) q.push(timer_at(i));
+			uint32_t sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				int handle = (int)((i * 7919) % pending);
+				Timer moved = q.value(handle);
+				moved.deadline += delays[i & (delayCount - 1)];
+				q.update(handle, moved);
+				sum += q.top().id;
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+	}
+}
+
+
+BENCH_CASE(priority_queue_timers)
+{
+	make_delays();
+	bench_schedule_fire(report, "schedule_fire_100", 100, report.scaled(1000000));
+	bench_schedule_fire(report, "schedule_fire_1k", 1000, report.scaled(500000));
+	bench_schedule_fire(report, "schedule_fire_10k", 10000, report.scaled(200000));
+}
+
+BENCH_CASE(priority_queue_reschedule)
+{
+	make_delays();
+	bench_reschedule(report, "reschedule_100", 100, report.scaled(500000));
+	bench_reschedule(report, "reschedule_1k", 1000, report.scaled(100000));
+	bench_reschedule(report, "reschedule_10k", 10000, report.scaled(20000));
+}
@@ -0,0 +1,226 @@
+#include "Bench.h"
+#include "Queue.h"
+
+#include <deque>
+
+using namespace ard_c;
+
+
+BENCH_CASE(queue_enqueue)
+{
+	const long n = report.scaled(1000000);
+	report.add("queue", "enqueue", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		Queue<int> q;
+		t.start();
+		for (long i = 0; i < n; ++i) q.enqueue((int)i);
+		t.stop();
+		bench::doNotOptimize(q.size());
+	}));
+	report.add("queue", "enqueue", "std", n, bench::measure([&](bench::Timer &t) {
+		std::deque<int> q;
+		t.start();
+		for (long i = 0; i < n; ++i) q.push_back((int)i);
+		t.stop();
+		bench::doNotOptimize(q.size());
+	}));
+}
+
+BENCH_CASE(queue_dequeue)
+{
+	const long n = report.scaled(1000000);
+	report.add("queue", "dequeue", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		Queue<int> q;
+		for (long i = 0; i < n; ++i) q.enqueue((int)i);
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) sum += q.dequeue();
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("queue", "dequeue", "std", n, bench::measure([&](bench::Timer &t) {
+		std::deque<int> q;
+		for (long i = 0; i < n; ++i) q.push_back((int)i);
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) { sum += q.front(); q.pop_front(); }
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
+
+BENCH_CASE(queue_steady_state)
+{
+	// File de profondeur constante : un enqueue et un dequeue par échantillon.
+	const long n = report.scaled(1000000);
+	const int depth = 32;
+	report.add("queue", "steady_state", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		Queue<int> q;
+		for (int i = 0; i < depth; ++i) q.enqueue(i);
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) { q.enqueue((int)i); sum += q.dequeue(); }
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("queue", "steady_state", "std", n, bench::measure([&](bench::Timer &t) {
+		std::deque<int> q;
+		for (int i = 0; i < depth; ++i) q.push_back(i);
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) { q.push_back((int)i); sum += q.front(); q.pop_front(); }
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
+
+BENCH_CASE(queue_at)
+{
+	const long size = report.scaled(100000);
+	const long n = size;
+	Queue<int> q;
+	std::deque<int> sq;
+	for (long i = 0; i < size; ++i) { q.enqueue((int)i); sq.push_back((int)i); }
+	// Décale la tête pour que le buffer circulaire soit effectivement enroulé.
+	for (long i = 0; i < size / 2; ++i) { q.enqueue(q.dequeue()); sq.push_back(sq.front()); sq.pop_front(); }
+
+	report.add("queue", "at", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		const Queue<int> &cq = q;
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) sum += cq.at((int)i);
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("queue", "at", "std", n, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) sum += sq[i];
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
+
+BENCH_CASE(queue_cow_copy_detach)
+{
+	const long size = report.scaled(10000);
+	const long n = 1000;
+	Queue<int> src;
+	std::deque<int> ssrc;
+	for (long i = 0; i < size; ++i) { src.enqueue((int)i); ssrc.push_back((int)i); }
+
+	report.add("queue", "cow_copy_detach", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			Queue<int> c(src);
+			c.enqueue((int)i);
+			bench::doNotOptimize(c.size());
+		}
+		t.stop();
+	}));
+	report.add("queue", "cow_copy_detach", "std", n, bench::measure([&](bench::Timer &t) {
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			std::deque<int> c(ssrc);
+			c.push_back((int)i);
+			bench::doNotOptimize(c.size());
+		}
+		t.stop();
+	}));
+}
+
+// Rafales d'octets d'un parser série : 64 à 256 octets produits puis consommés d'un coup.
+BENCH_CASE(queue_batch)
+{
+	const long n = report.scaled(20000);
+	uint8_t in[256];
+	uint8_t out[256];
+	for (int i = 0; i < 256; ++i) in[i] = (uint8_t)i;
+	const int sizes[] = { 64, 256 };
+	const char *names[] = { "burst_64_bytes", "burst_256_bytes" };
+
+	for (int s = 0; s < 2; ++s)
+	{
+		const int burst = sizes[s];
+		report.add("queue", names[s], "per_element", n * burst, bench::measure([&](bench::Timer &t) {
+			Queue<uint8_t> q;
+			long sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				for (int k = 0; k < burst; ++k) q.enqueue(in[k]);
+				for (int k = 0; k < burst; ++k) out[k] = q.dequeue();
+				sum += out[burst - 1];
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+		report.add("queue", names[s], "batch", n * burst, bench::measure([&](bench::Timer &t) {
+			Queue<uint8_t> q;
+			long sum = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				q.enqueue(in, burst);
+				sum += q.dequeue(out, burst);
+				sum += out[burst - 1];
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+	}
+}
+
+namespace
+{
+	// Tas comptant les appels, pour vérifier qu'une file réservée ne touche plus au tas.
+	struct CountingHeap
+	{
+		static long calls;
+		static void *allocate(size_t bytes) { ++calls; return ::malloc(bytes); }
+		static void *reallocate(void *p, size_t, size_t bytes) { ++calls; return ::realloc(p, bytes); }
+		static void deallocate(void *p, size_t) { if (p) ++calls; ::free(p); }
+	};
+	long CountingHeap::calls = 0;
+
+	template<bool Reserve>
+	void queue_bursts(bench::Reporter &report, const char *impl)
+	{
+		const long bursts = report.scaled(20000);
+		const int burst = 200;
+		long calls = 0;
+		report.add("queue", "bursts_of_200", impl, bursts * burst, bench::measure([&](bench::Timer &t) {
+			long sum = 0;
+			t.start();
+			for (long b = 0; b < bursts; ++b)
+			{
+				Queue<int, RefCount, CountingHeap> q;
+				if (Reserve) q.reserve(burst);
+				for (int i = 0; i < burst; ++i) q.enqueue(i);
+				while (!q.isEmpty()) sum += q.dequeue();
+			}
+			t.stop();
+			bench::doNotOptimize(sum);
+		}));
+
+		// Régime établi : une file qui a déjà atteint sa capacité ne fait plus aucun appel.
+		Queue<int, RefCount, CountingHeap> q;
+		if (Reserve) q.reserve(burst);
+		CountingHeap::calls = 0;
+		for (int b = 0; b < 100; ++b)
+		{
+			for (int i = 0; i < burst; ++i) q.enqueue(i);
+			while (!q.isEmpty()) q.dequeue();
+			if (b == 0) calls = CountingHeap::calls;
+		}
+		fprintf(stderr, "queue    heap_calls               %-12s first_burst=%ld next_99_bursts=%ld\n",
+			impl, calls, CountingHeap::calls - calls);
+	}
+}
+
+BENCH_CASE(queue_reserve)
+{
+	queue_bursts<false>(report, "grow");
+	queue_bursts<true>(report, "reserve");
+}
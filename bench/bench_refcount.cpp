@@ -0,0 +1,123 @@
+#include "Bench.h"
+#include "Vector.h"
+
+#include <thread>
+
+using namespace ard_c;
+
+
+template<typename R>
+static void single_thread(bench::Reporter &report, const char *impl)
+{
+	const long size = report.scaled(1000);
+	const long n = report.scaled(100000);
+	Vector<int, R> src(size);
+	for (long i = 0; i < size; ++i) src.append((int)i);
+
+	report.add("refcount", "copy_read", impl, n, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			Vector<int, R> c(src);
+			sum += c.at(0);
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("refcount", "copy_detach", impl, n, bench::measure([&](bench::Timer &t) {
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			Vector<int, R> c(src);
+			c[0] = (int)i;
+			bench::doNotOptimize(c.at(0));
+		}
+		t.stop();
+	}));
+}
+
+// Plusieurs threads copient et lisent le même Vector : seules les politiques
+// AtomicRefCount et UnsharedRefCount le permettent sans course de données.
+template<typename R>
+static void multi_thread(bench::Reporter &report, const char *impl, int threads)
+{
+	const long size = report.scaled(1000);
+	const long n = report.scaled(100000);
+	Vector<int, R> src(size);
+	for (long i = 0; i < size; ++i) src.append((int)i);
+
+	report.add("refcount", threads == 2 ? "copy_read_2threads" : "copy_read_4threads", impl, n * threads,
+		bench::measure([&](bench::Timer &t) {
+		std::thread pool[4];
+		t.start();
+		for (int k = 0; k < threads; ++k)
+		{
+			pool[k] = std::thread([&]() {
+				long sum = 0;
+				for (long i = 0; i < n; ++i)
+				{
+					Vector<int, R> c(src);
+					sum += c.at(0);
+				}
+				bench::doNotOptimize(sum);
+			});
+		}
+		for (int k = 0; k < threads; ++k) pool[k].join();
+		t.stop();
+	}, 3));
+}
+
+// Plusieurs threads copient le même Vector et écrivent dans leur copie : chaque écriture la
+// détache pendant que les autres threads copient et relâchent le même buffer. Chaque thread
+// commence par détacher une copie d'un buffer partagé uniquement entre les threads, ce qui
+// met en concurrence les derniers propriétaires du buffer.
+template<typename R>
+static void multi_thread_detach(bench::Reporter &report, const char *impl, int threads)
+{
+	const long size = report.scaled(1000);
+	const long n = report.scaled(100000);
+	Vector<int, R> src(size);
+	for (long i = 0; i < size; ++i) src.append((int)i);
+
+	report.add("refcount", threads == 2 ? "copy_detach_2threads" : "copy_detach_4threads", impl, n * threads,
+		bench::measure([&](bench::Timer &t) {
+		std::thread pool[4];
+		Vector<int, R> first[4];
+		{
+			Vector<int, R> shared(src);
+			shared[0] = -1;
+			for (int k = 0; k < threads; ++k) first[k] = shared;
+		}
+		t.start();
+		for (int k = 0; k < threads; ++k)
+		{
+			pool[k] = std::thread([&, k]() {
+				first[k][0] = k;
+				for (long i = 0; i < n; ++i)
+				{
+					Vector<int, R> c(src);
+					c[0] = (int)i;
+					bench::doNotOptimize(c.at(0));
+				}
+			});
+		}
+		for (int k = 0; k < threads; ++k) pool[k].join();
+		t.stop();
+	}, 3));
+}
+
+BENCH_CASE(refcount_policies)
+{
+	single_thread<RefCount>(report, "plain");
+	single_thread<AtomicRefCount>(report, "atomic");
+	single_thread<UnsharedRefCount>(report, "unshared");
+	multi_thread<AtomicRefCount>(report, "atomic", 2);
+	multi_thread<AtomicRefCount>(report, "atomic", 4);
+	multi_thread<UnsharedRefCount>(report, "unshared", 2);
+	multi_thread<UnsharedRefCount>(report, "unshared", 4);
+	multi_thread_detach<AtomicRefCount>(report, "atomic", 2);
+	multi_thread_detach<AtomicRefCount>(report, "atomic", 4);
+	multi_thread_detach<UnsharedRefCount>(report, "unshared", 2);
+	multi_thread_detach<UnsharedRefCount>(report, "unshared", 4);
+}
@@ -0,0 +1,101 @@
+#include "Bench.h"
+#include "Vector.h"
+
+using namespace ard_c;
+
+
+namespace
+{
+	// Même taille qu'un pointeur + int, mais déplacée par move-construct + destruction.
+	struct Rich
+	{
+		int *p;
+		int v;
+
+		Rich(int x) : p(0), v(x) {}
+		Rich(const Rich &o) : p(0), v(o.v) {}
+		Rich(Rich &&o) : p(o.p), v(o.v) { o.p = 0; }
+		~Rich() { bench::clobber(); }
+	};
+
+	// Trivialement copiable : détecté automatiquement comme primitif.
+	struct Plain
+	{
+		int *p;
+		int v;
+
+		Plain(int x) : p(0), v(x) {}
+	};
+}
+
+// Sample est détecté comme primitif, SlowSample a la même structure
+// mais est forcé dans le chemin élément par élément pour comparaison.
+struct Sample
+{
+	int16_t x, y, z;
+};
+struct SlowSample
+{
+	int16_t x, y, z;
+};
+ARD_C_DECLARE_TYPEINFO(SlowSample, ARD_C_COMPLEX_TYPE)
+
+
+template<typename T>
+static void relocation_cases(bench::Reporter &report, const char *impl)
+{
+	const long grow = report.scaled(1000000);
+	report.add("reloc", "append_grow", impl, grow, bench::measure([&](bench::Timer &t) {
+		Vector<T> v;
+		t.start();
+		for (long i = 0; i < grow; ++i) v.emplaceBack((int)i);
+		t.stop();
+	}));
+
+	const long n = report.scaled(20000);
+	report.add("reloc", "insert_front", impl, n, bench::measure([&](bench::Timer &t) {
+		Vector<T> v;
+		t.start();
+		for (long i = 0; i < n; ++i) v.emplace(0, (int)i);
+		t.stop();
+	}));
+	report.add("reloc", "remove_front", impl, n, bench::measure([&](bench::Timer &t) {
+		Vector<T> v(n);
+		for (long i = 0; i < n; ++i) v.emplaceBack((int)i);
+		t.start();
+		for (long i = 0; i < n; ++i) v.removeFirst();
+		t.stop();
+	}));
+}
+
+BENCH_CASE(reloc_paths)
+{
+	relocation_cases<Plain>(report, "memmove");
+	relocation_cases<Rich>(report, "move_construct");
+}
+
+template<typename T>
+static void copy_case(bench::Reporter &report, const char *impl)
+{
+	const long size = report.scaled(10000);
+	const long n = 1000;
+	Vector<T> src(size);
+	T s = { 1, 2, 3 };
+	for (long i = 0; i < size; ++i) src.append(s);
+	report.add("reloc", "deep_copy_pod", impl, n, bench::measure([&](bench::Timer &t) {
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			Vector<T> c(src);
+			c.removeLast();
+			bench::doNotOptimize(c.size());
+		}
+		t.stop();
+	}));
+}
+
+BENCH_CASE(reloc_typeinfo)
+{
+	copy_case<Sample>(report, "primitive");
+	copy_case<SlowSample>(report, "complex");
+}
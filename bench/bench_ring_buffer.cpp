@@ -0,0 +1,145 @@
+#include "Bench.h"
+#include "Queue.h"
+#include "RollingStats.h"
+
+#include <stdlib.h>
+
+using namespace ard_c;
+
+
+namespace
+{
+	// Échantillons de capteur 16 bits tirés à l'avance, hors chrono.
+	const int sampleCount = 4096;
+	int16_t samples[sampleCount];
+
+	void make_samples()
+	{
+		srand(11);
+		for (int i = 0; i < sampleCount; ++i) samples[i] = (int16_t)(512 + rand() % 1024);
+	}
+
+	// Moyenne, variance, min et max d'une fenêtre en deux plages contiguës.
+	template<typename Accum>
+	void scan(const int16_t *d, int n, Accum &sum, Accum &sumSq, int16_t &mn, int16_t &mx)
+	{
+		for (int i = 0; i < n; ++i)
+		{
+			int16_t x = d[i];
+			sum += x;
+			sumSq += (Accum)x * x;
+			if (x < mn) mn = x;
+			if (mx < x) mx = x;
+		}
+	}
+
+	// Un tick : un échantillon entre, la fenêtre de N échantillons est interrogée.
+	template<int N>
+	void bench_window(bench::Reporter &report, const char *name, long n)
+	{
+		report.add("ring_buffer", name, "queue_rescan", n, bench::measure([&](bench::Timer &t) {
+			// Approche actuelle : Queue + enqueue / dequeue et relecture par at().
+			Queue<int16_t> q;
+			for (int i = 0; i < N; ++i) q.enqueue(samples[i & (sampleCount - 1)]);
+			double acc = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				q.dequeue();
+				q.enqueue(samples[i & (sampleCount - 1)]);
+				int64_t sum = 0;
+				int64_t sumSq = 0;
+				int16_t mn = q.at(0);
+				int16_t mx = mn;
+				for (int j = 0; j < q.size(); ++j)
+				{
+					int16_t x = q.at(j);
+					sum += x;
+					sumSq += (int64_t)x * x;
+					if (x < mn) mn = x;
+					if (mx < x) mx = x;
+				}
+				double mean = (double)sum / N;
+				acc += mean + ((double)sumSq / N - mean * mean) + mn + mx;
+			}
+			t.stop();
+			bench::doNotOptimize(acc);
+		}));
+		report.add("ring_buffer", name, "ring_rescan", n, bench::measure([&](bench::Timer &t) {
+			RingBuffer<int16_t, N> r;
+			for (int i = 0; i < N; ++i) r.push(samples[i & (sampleCount - 1)]);
+			double acc = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				r.push(samples[i & (sampleCount - 1)]);
+				int64_t sum = 0;
+				int64_t sumSq = 0;
+				int16_t mn = r.first();
+				int16_t mx = mn;
+				Span<const int16_t> a = static_cast<const RingBuffer<int16_t, N>&>(r).firstHalf();
+				Span<const int16_t> b = static_cast<const RingBuffer<int16_t, N>&>(r).secondHalf();
+				scan(a.data(), a.size(), sum, sumSq, mn, mx);
+				scan(b.data(), b.size(), sum, sumSq, mn, mx);
+				double mean = (double)sum / N;
+				acc += mean + ((double)sumSq / N - mean * mean) + mn + mx;
+			}
+			t.stop();
+			bench::doNotOptimize(acc);
+		}));
+		report.add("ring_buffer", name, "rolling_stats", n, bench::measure([&](bench::Timer &t) {
+			RollingStats<int16_t, N> s;
+			for (int i = 0; i < N; ++i) s.add(samples[i & (sampleCount - 1)]);
+			double acc = 0;
+			t.start();
+			for (long i = 0; i < n; ++i)
+			{
+				s.add(samples[i & (sampleCount - 1)]);
+				acc += s.mean() + s.variance() + s.minimum() + s.maximum();
+			}
+			t.stop();
+			bench::doNotOptimize(acc);
+		}));
+	}
+}
+
+
+BENCH_CASE(ring_buffer_rolling_stats)
+{
+	make_samples();
+	bench_window<16>(report, "tick_window_16", report.scaled(1000000));
+	bench_window<64>(report, "tick_window_64", report.scaled(500000));
+	bench_window<1024>(report, "tick_window_1024", report.scaled(50000));
+}
+
+BENCH_CASE(ring_buffer_push)
+{
+	const long n = report.scaled(2000000);
+	make_samples();
+	report.add("ring_buffer", "push_overwrite_64", "queue", n, bench::measure([&](bench::Timer &t) {
+		Queue<int16_t> q;
+		for (int i = 0; i < 64; ++i) q.enqueue(0);
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			sum += q.dequeue();
+			q.enqueue(samples[i & (sampleCount - 1)]);
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("ring_buffer", "push_overwrite_64", "ring_buffer", n, bench::measure([&](bench::Timer &t) {
+		RingBuffer<int16_t, 64> r;
+		for (int i = 0; i < 64; ++i) r.push(0);
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			sum += r.first();
+			r.push(samples[i & (sampleCount - 1)]);
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
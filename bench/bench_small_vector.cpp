@@ -0,0 +1,45 @@
+#include "Bench.h"
+#include "SmallVector.h"
+
+#include <vector>
+
+using namespace ard_c;
+
+
+// Nombreux petits vecteurs éphémères, comme dans une itération de loop().
+template<typename V>
+static double short_lived(long n, int elements)
+{
+	return bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			V v;
+			for (int k = 0; k < elements; ++k) v.append(k);
+			sum += v.at(elements - 1);
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	});
+}
+
+BENCH_CASE(small_vector_short_lived)
+{
+	const long n = report.scaled(200000);
+	report.add("small", "short_lived_6", "Vector", n, short_lived<Vector<int> >(n, 6));
+	report.add("small", "short_lived_6", "SmallVector8", n, short_lived<SmallVector<int, 8> >(n, 6));
+	report.add("small", "short_lived_12", "SmallVector8", n, short_lived<SmallVector<int, 8> >(n, 12));
+	report.add("small", "short_lived_6", "std", n, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			std::vector<int> v;
+			for (int k = 0; k < 6; ++k) v.push_back(k);
+			sum += v[5];
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
@@ -0,0 +1,145 @@
+#include "Bench.h"
+#include "Vector.h"
+#include "SoAVector.h"
+#include "Numeric.h"
+
+using namespace ard_c;
+
+
+namespace
+{
+	struct Reading
+	{
+		uint32_t timestamp;
+		uint16_t channel;
+		uint8_t flags;
+		float value;
+	};
+
+	typedef SoAVector<uint32_t, uint16_t, uint8_t, float> Readings;
+	enum { Timestamp, Channel, Flags, Value };
+
+	// Un million de mesures ( 12 Mo en AoS ) : plus que le cache, comme un historique réel.
+	const int Rows = 1000000;
+
+	float reading_value(int i) { return (float)((i * 37) % 1000) * 0.01f; }
+
+	void fill(Vector<Reading> &aos, Readings &soa)
+	{
+		aos.reserve(Rows);
+		soa.reserve(Rows);
+		for (int i = 0; i < Rows; ++i)
+		{
+			Reading r = { (uint32_t)i * 10, (uint16_t)(i & 63), (uint8_t)(i % 7 == 0), reading_value(i) };
+			aos.append(r);
+			soa.append(r.timestamp, r.channel, r.flags, r.value);
+		}
+	}
+}
+
+
+BENCH_CASE(soa_vector_scan)
+{
+	const long reps = report.scaled(20);
+	Vector<Reading> aos;
+	Readings soa;
+	fill(aos, soa);
+	const Vector<Reading> &caos = aos;
+	const Readings &csoa = soa;
+
+	// Somme des valeurs : seul le champ 'value' est lu.
+	report.add("soa_vector", "sum_value", "aos_vector", reps * Rows, bench::measure([&](bench::Timer &t) {
+		double s = 0;
+		t.start();
+		for (long r = 0; r < reps; ++r)
+		{
+			const Reading *p = caos.constData();
+			float acc = 0;
+			for (int i = 0; i < Rows; ++i) acc += p[i].value;
+			s += acc;
+		}
+		t.stop();
+		bench::doNotOptimize(s);
+	}));
+	report.add("soa_vector", "sum_value", "soa_vector", reps * Rows, bench::measure([&](bench::Timer &t) {
+		double s = 0;
+		t.start();
+		for (long r = 0; r < reps; ++r)
+		{
+			Span<const float> v = csoa.column<Value>();
+			s += sum(v.begin(), v.end());
+		}
+		t.stop();
+		bench::doNotOptimize(s);
+	}));
+
+	// Nombre de mesures au-dessus d'un seuil.
+	report.add("soa_vector", "count_above", "aos_vector", reps * Rows, bench::measure([&](bench::Timer &t) {
+		long c = 0;
+		t.start();
+		for (long r = 0; r < reps; ++r)
+		{
+			const Reading *p = caos.constData();
+			for (int i = 0; i < Rows; ++i) c += p[i].value > 5.0f;
+		}
+		t.stop();
+		bench::doNotOptimize(c);
+	}));
+	report.add("soa_vector", "count_above", "soa_vector", reps * Rows, bench::measure([&](bench::Timer &t) {
+		long c = 0;
+		t.start();
+		for (long r = 0; r < reps; ++r)
+		{
+			const float *p = csoa.column<Value>().begin();
+			for (int i = 0; i < Rows; ++i) c += p[i] > 5.0f;
+		}
+		t.stop();
+		bench::doNotOptimize(c);
+	}));
+
+	// Mise à l'échelle en place.
+	report.add("soa_vector", "scale_value", "aos_vector", reps * Rows, bench::measure([&](bench::Timer &t) {
+		t.start();
+		for (long r = 0; r < reps; ++r)
+		{
+			Reading *p = aos.data();
+			for (int i = 0; i < Rows; ++i) p[i].value *= 1.0001f;
+			bench::doNotOptimize(p);
+		}
+		t.stop();
+	}));
+	report.add("soa_vector", "scale_value", "soa_vector", reps * Rows, bench::measure([&](bench::Timer &t) {
+		t.start();
+		for (long r = 0; r < reps; ++r)
+		{
+			float *p = soa.column<Value>().begin();
+			for (int i = 0; i < Rows; ++i) p[i] *= 1.0001f;
+			bench::doNotOptimize(p);
+		}
+		t.stop();
+	}));
+}
+
+BENCH_CASE(soa_vector_append)
+{
+	// Coût de l'écriture par ligne : quatre buffers au lieu d'un.
+	const long n = report.scaled(1000000);
+	report.add("soa_vector", "append", "aos_vector", n, bench::measure([&](bench::Timer &t) {
+		t.start();
+		Vector<Reading> v;
+		for (long i = 0; i < n; ++i)
+		{
+			Reading r = { (uint32_t)i, (uint16_t)(i & 63), 0, (float)i };
+			v.append(r);
+		}
+		t.stop();
+		bench::doNotOptimize(v.size());
+	}));
+	report.add("soa_vector", "append", "soa_vector", n, bench::measure([&](bench::Timer &t) {
+		t.start();
+		Readings v;
+		for (long i = 0; i < n; ++i) v.append((uint32_t)i, (uint16_t)(i & 63), (uint8_t)0, (float)i);
+		t.stop();
+		bench::doNotOptimize(v.size());
+	}));
+}
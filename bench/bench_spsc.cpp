@@ -0,0 +1,82 @@
+#include "Bench.h"
+#include "SpscQueue.h"
+
+#include <thread>
+
+using namespace ard_c;
+
+
+// Stress test producteur / consommateur sur deux threads : vérifie que chaque message
+// arrive dans l'ordre et mesure le débit. Un écart d'ordre arrête le benchmark.
+// Les deux côtés cèdent la main quand la file est pleine ou vide, pour rester
+// mesurables sur une machine mono-coeur.
+template<int N>
+static double two_threads(long messages, int batch)
+{
+	return bench::measure([&](bench::Timer &t) {
+		SpscQueue<uint32_t, N> q;
+		long errors = 0;
+		t.start();
+		std::thread consumer([&]() {
+			uint32_t expected = 0;
+			uint32_t buf[64];
+			while (expected != (uint32_t)messages)
+			{
+				int got;
+				if (batch > 1) got = q.popN(buf, batch);
+				else got = q.pop(buf[0]) ? 1 : 0;
+				if (!got) std::this_thread::yield();
+				for (int i = 0; i < got; ++i)
+				{
+					if (buf[i] != expected) ++errors;
+					++expected;
+				}
+			}
+		});
+		uint32_t next = 0;
+		uint32_t buf[64];
+		while (next != (uint32_t)messages)
+		{
+			if (batch > 1)
+			{
+				int n = batch;
+				if ((long)next + n > messages) n = (int)(messages - next);
+				for (int i = 0; i < n; ++i) buf[i] = next + i;
+				int pushed = q.pushN(buf, n);
+				if (!pushed) std::this_thread::yield();
+				next += pushed;
+			}
+			else if (q.push(next)) ++next;
+			else std::this_thread::yield();
+		}
+		consumer.join();
+		t.stop();
+		if (errors)
+		{
+			fprintf(stderr, "SpscQueue ordering error : %ld messages out of order\n", errors);
+			abort();
+		}
+	}, 3);
+}
+
+BENCH_CASE(spsc_two_threads)
+{
+	const long n = report.scaled(10000000);
+	report.add("spsc", "two_threads", "single_1024", n, two_threads<1024>(n, 1));
+	report.add("spsc", "two_threads", "batch16_1024", n, two_threads<1024>(n, 16));
+	report.add("spsc", "two_threads", "batch64_128", n, two_threads<128>(n, 64));
+}
+
+BENCH_CASE(spsc_single_thread)
+{
+	const long n = report.scaled(10000000);
+	report.add("spsc", "push_pop", "SpscQueue", n, bench::measure([&](bench::Timer &t) {
+		SpscQueue<int, 64> q;
+		long sum = 0;
+		int v = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) { q.push((int)i); q.pop(v); sum += v; }
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
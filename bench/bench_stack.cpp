@@ -0,0 +1,49 @@
+#include "Bench.h"
+#include "Stack.h"
+
+#include <vector>
+
+using namespace ard_c;
+
+
+BENCH_CASE(stack_push)
+{
+	const long n = report.scaled(1000000);
+	report.add("stack", "push", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		Stack<int> s;
+		t.start();
+		for (long i = 0; i < n; ++i) s.push((int)i);
+		t.stop();
+		bench::doNotOptimize(s.size());
+	}));
+	report.add("stack", "push", "std", n, bench::measure([&](bench::Timer &t) {
+		std::vector<int> s;
+		t.start();
+		for (long i = 0; i < n; ++i) s.push_back((int)i);
+		t.stop();
+		bench::doNotOptimize(s.size());
+	}));
+}
+
+BENCH_CASE(stack_pop)
+{
+	const long n = report.scaled(1000000);
+	report.add("stack", "pop", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		Stack<int> s;
+		for (long i = 0; i < n; ++i) s.push((int)i);
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) sum += s.pop();
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("stack", "pop", "std", n, bench::measure([&](bench::Timer &t) {
+		std::vector<int> s;
+		for (long i = 0; i < n; ++i) s.push_back((int)i);
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) { sum += s.back(); s.pop_back(); }
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
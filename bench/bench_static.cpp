@@ -0,0 +1,58 @@
+#include "Bench.h"
+#include "Queue.h"
+#include "Stack.h"
+#include "StaticQueue.h"
+#include "StaticStack.h"
+
+using namespace ard_c;
+
+
+BENCH_CASE(static_queue_steady_state)
+{
+	const long n = report.scaled(1000000);
+	report.add("static", "queue_steady_state", "Queue", n, bench::measure([&](bench::Timer &t) {
+		Queue<int> q;
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) { q.enqueue((int)i); sum += q.dequeue(); }
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("static", "queue_steady_state", "StaticQueue64", n, bench::measure([&](bench::Timer &t) {
+		StaticQueue<int, 64> q;
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) { q.enqueue((int)i); sum += q.dequeue(); }
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
+
+BENCH_CASE(static_stack_push_pop)
+{
+	const long n = report.scaled(1000000);
+	report.add("static", "stack_fill_drain", "Stack", n, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n / 32; ++i)
+		{
+			Stack<int> s;
+			for (int k = 0; k < 32; ++k) s.push(k);
+			while (!s.isEmpty()) sum += s.pop();
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("static", "stack_fill_drain", "StaticStack32", n, bench::measure([&](bench::Timer &t) {
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n / 32; ++i)
+		{
+			StaticStack<int, 32> s;
+			for (int k = 0; k < 32; ++k) s.push(k);
+			while (!s.isEmpty()) sum += s.pop();
+		}
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
@@ -0,0 +1,252 @@
+#include "Bench.h"
+#include "Vector.h"
+
+#include <vector>
+
+using namespace ard_c;
+
+
+BENCH_CASE(vector_append)
+{
+	const long n = report.scaled(1000000);
+	report.add("vector", "append", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		Vector<int> v;
+		t.start();
+		for (long i = 0; i < n; ++i) v.append((int)i);
+		t.stop();
+		bench::doNotOptimize(v.size());
+	}));
+	report.add("vector", "append", "std", n, bench::measure([&](bench::Timer &t) {
+		std::vector<int> v;
+		t.start();
+		for (long i = 0; i < n; ++i) v.push_back((int)i);
+		t.stop();
+		bench::doNotOptimize(v.size());
+	}));
+}
+
+BENCH_CASE(vector_insert_front)
+{
+	const long n = report.scaled(20000);
+	report.add("vector", "insert_front", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		Vector<int> v;
+		t.start();
+		for (long i = 0; i < n; ++i) v.insert((int)i, 0);
+		t.stop();
+		bench::doNotOptimize(v.size());
+	}));
+	report.add("vector", "insert_front", "std", n, bench::measure([&](bench::Timer &t) {
+		std::vector<int> v;
+		t.start();
+		for (long i = 0; i < n; ++i) v.insert(v.begin(), (int)i);
+		t.stop();
+		bench::doNotOptimize(v.size());
+	}));
+}
+
+BENCH_CASE(vector_insert_middle)
+{
+	const long n = report.scaled(20000);
+	report.add("vector", "insert_middle", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		Vector<int> v;
+		t.start();
+		for (long i = 0; i < n; ++i) v.insert((int)i, v.size() / 2);
+		t.stop();
+		bench::doNotOptimize(v.size());
+	}));
+	report.add("vector", "insert_middle", "std", n, bench::measure([&](bench::Timer &t) {
+		std::vector<int> v;
+		t.start();
+		for (long i = 0; i < n; ++i) v.insert(v.begin() + v.size() / 2, (int)i);
+		t.stop();
+		bench::doNotOptimize(v.size());
+	}));
+}
+
+BENCH_CASE(vector_remove_front)
+{
+	const long n = report.scaled(20000);
+	report.add("vector", "remove_front", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		Vector<int> v(n);
+		for (long i = 0; i < n; ++i) v.append((int)i);
+		t.start();
+		for (long i = 0; i < n; ++i) v.removeFirst();
+		t.stop();
+		bench::doNotOptimize(v.size());
+	}));
+	report.add("vector", "remove_front", "std", n, bench::measure([&](bench::Timer &t) {
+		std::vector<int> v;
+		v.reserve(n);
+		for (long i = 0; i < n; ++i) v.push_back((int)i);
+		t.start();
+		for (long i = 0; i < n; ++i) v.erase(v.begin());
+		t.stop();
+		bench::doNotOptimize(v.size());
+	}));
+}
+
+// Buffer de log de 4096 entrées dont on retire les 300 plus anciennes.
+BENCH_CASE(vector_drop_oldest)
+{
+	const long n = report.scaled(2000);
+	const int size = 4096;
+	const int drop = 300;
+	report.add("vector", "drop_oldest_300", "remove_loop", n, bench::measure([&](bench::Timer &t) {
+		for (long i = 0; i < n; ++i)
+		{
+			Vector<int> v(size);
+			for (int k = 0; k < size; ++k) v.append(k);
+			t.start();
+			for (int k = 0; k < drop; ++k) v.removeFirst();
+			t.stop();
+			bench::doNotOptimize(v.size());
+		}
+	}));
+	report.add("vector", "drop_oldest_300", "remove_range", n, bench::measure([&](bench::Timer &t) {
+		for (long i = 0; i < n; ++i)
+		{
+			Vector<int> v(size);
+			for (int k = 0; k < size; ++k) v.append(k);
+			t.start();
+			v.remove(0, drop);
+			t.stop();
+			bench::doNotOptimize(v.size());
+		}
+	}));
+	report.add("vector", "drop_oldest_300", "std", n, bench::measure([&](bench::Timer &t) {
+		for (long i = 0; i < n; ++i)
+		{
+			std::vector<int> v;
+			v.reserve(size);
+			for (int k = 0; k < size; ++k) v.push_back(k);
+			t.start();
+			v.erase(v.begin(), v.begin() + drop);
+			t.stop();
+			bench::doNotOptimize(v.size());
+		}
+	}));
+}
+
+BENCH_CASE(vector_remove_half)
+{
+	const long n = report.scaled(200);
+	const int size = 4096;
+	report.add("vector", "remove_odd_half", "remove_loop", n, bench::measure([&](bench::Timer &t) {
+		for (long i = 0; i < n; ++i)
+		{
+			Vector<int> v(size);
+			for (int k = 0; k < size; ++k) v.append(k);
+			t.start();
+			for (int k = v.size() - 1; k >= 0; --k) if (v.at(k) & 1) v.remove(k);
+			t.stop();
+			bench::doNotOptimize(v.size());
+		}
+	}));
+	report.add("vector", "remove_odd_half", "removeIf", n, bench::measure([&](bench::Timer &t) {
+		for (long i = 0; i < n; ++i)
+		{
+			Vector<int> v(size);
+			for (int k = 0; k < size; ++k) v.append(k);
+			t.start();
+			v.removeIf([](int x) { return (x & 1) != 0; });
+			t.stop();
+			bench::doNotOptimize(v.size());
+		}
+	}));
+}
+
+BENCH_CASE(vector_insert_range)
+{
+	const long n = report.scaled(2000);
+	const int size = 1024;
+	const int count = 256;
+	int range[count];
+	for (int k = 0; k < count; ++k) range[k] = k;
+	report.add("vector", "insert_256_middle", "insert_loop", n, bench::measure([&](bench::Timer &t) {
+		for (long i = 0; i < n; ++i)
+		{
+			Vector<int> v(size + count);
+			for (int k = 0; k < size; ++k) v.append(k);
+			t.start();
+			for (int k = 0; k < count; ++k) v.insert(range[k], size / 2 + k);
+			t.stop();
+			bench::doNotOptimize(v.size());
+		}
+	}));
+	report.add("vector", "insert_256_middle", "insert_range", n, bench::measure([&](bench::Timer &t) {
+		for (long i = 0; i < n; ++i)
+		{
+			Vector<int> v(size + count);
+			for (int k = 0; k < size; ++k) v.append(k);
+			t.start();
+			v.insert(size / 2, range, count);
+			t.stop();
+			bench::doNotOptimize(v.size());
+		}
+	}));
+}
+
+BENCH_CASE(vector_take_last)
+{
+	const long n = report.scaled(1000000);
+	report.add("vector", "take_last", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		Vector<int> v(n);
+		for (long i = 0; i < n; ++i) v.append((int)i);
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) sum += v.takeLast();
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+	report.add("vector", "take_last", "std", n, bench::measure([&](bench::Timer &t) {
+		std::vector<int> v;
+		v.reserve(n);
+		for (long i = 0; i < n; ++i) v.push_back((int)i);
+		long sum = 0;
+		t.start();
+		for (long i = 0; i < n; ++i) { sum += v.back(); v.pop_back(); }
+		t.stop();
+		bench::doNotOptimize(sum);
+	}));
+}
+
+BENCH_CASE(vector_cow_copy_detach)
+{
+	// Coût d'une copie suivie d'une première écriture : shallow copy puis deep copy
+	// au detach() pour Vector, copie immédiate pour std::vector.
+	const long size = report.scaled(10000);
+	const long n = 1000;
+	Vector<int> src(size);
+	std::vector<int> ssrc;
+	for (long i = 0; i < size; ++i) { src.append((int)i); ssrc.push_back((int)i); }
+
+	report.add("vector", "cow_copy_detach", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			Vector<int> c(src);
+			c[0] = (int)i;
+			bench::doNotOptimize(c.at(0));
+		}
+		t.stop();
+	}));
+	report.add("vector", "cow_copy_detach", "std", n, bench::measure([&](bench::Timer &t) {
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			std::vector<int> c(ssrc);
+			c[0] = (int)i;
+			bench::doNotOptimize(c[0]);
+		}
+		t.stop();
+	}));
+	report.add("vector", "cow_copy_only", "ard_c", n, bench::measure([&](bench::Timer &t) {
+		t.start();
+		for (long i = 0; i < n; ++i)
+		{
+			Vector<int> c(src);
+			bench::doNotOptimize(c.at(0));
+		}
+		t.stop();
+	}));
+}
@@ -0,0 +1,75 @@
+// Compteurs d'instrumentation ( ARD_C_INSTRUMENT ) sur une charge représentative.
+// Compilé à part de collection_bench : ARD_C_INSTRUMENT change la taille des data internes
+// et doit être défini pour toutes les unités de compilation d'un même programme.
+
+#include "Vector.h"
+#include "Stack.h"
+#include "Queue.h"
+#include "Deque.h"
+
+#include <string.h>
+
+using namespace ard_c;
+
+
+int main(int argc, char **argv)
+{
+	bool json = argc > 1 && !strcmp(argv[1], "--format=json");
+	if (argc > 1 && !json)
+	{
+		Serial.println("usage: collection_stats [--format=json]");
+		return 2;
+	}
+
+	Vector<int> samples;
+	for (int i = 0; i < 1000; ++i) samples.append(i);
+	for (int i = 0; i < 100; ++i) samples.insert(i, 0);
+	for (int i = 0; i < 100; ++i) samples.removeFirst();
+
+	Vector<int> snapshot(samples);
+	snapshot[0] = -1;
+
+	Stack<int> stack;
+	for (int i = 0; i < 64; ++i) stack.push(i);
+	while (!stack.isEmpty()) stack.pop();
+
+	Queue<int> events;
+	for (int burst = 0; burst < 10; ++burst)
+	{
+		for (int i = 0; i < 100; ++i) events.enqueue(i);
+		while (!events.isEmpty()) events.dequeue();
+	}
+	events.shrink();
+
+	Deque<int> history;
+	for (int i = 0; i < 500; ++i)
+	{
+		if (i & 1) history.prepend(i);
+		else history.append(i);
+		if (history.size() > 100) history.removeFirst();
+	}
+
+	if (json)
+	{
+		Serial.print("{ \"samples\": ");
+		samples.stats().dumpJson(Serial);
+		Serial.print(", \"snapshot\": ");
+		snapshot.stats().dumpJson(Serial);
+		Serial.print(", \"events\": ");
+		events.stats().dumpJson(Serial);
+		Serial.print(", \"history\": ");
+		history.stats().dumpJson(Serial);
+		Serial.print(", \"global\": ");
+		globalStats().dumpJson(Serial);
+		Serial.println("}");
+	}
+	else
+	{
+		samples.stats().dump(Serial, "samples");
+		snapshot.stats().dump(Serial, "snapshot");
+		events.stats().dump(Serial, "events");
+		history.stats().dump(Serial, "history");
+		globalStats().dump(Serial);
+	}
+	return 0;
+}
@@ -0,0 +1,105 @@
+#include "arduino.h"
+
+#include <stdio.h>
+#include <time.h>
+
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+	size_t n = 0;
+	while (size--) n += write(*buffer++);
+	return n;
+}
+
+size_t Print::print(long n, int base)
+{
+	if (n < 0 && base == DEC) return print('-') + print((unsigned long)-n, base);
+	return print((unsigned long)n, base);
+}
+
+size_t Print::print(unsigned long n, int base)
+{
+	return print((unsigned long long)n, base);
+}
+
+size_t Print::print(long long n, int base)
+{
+	if (n < 0 && base == DEC) return print('-') + print((unsigned long long)-n, base);
+	return print((unsigned long long)n, base);
+}
+
+size_t Print::print(unsigned long long n, int base)
+{
+	char buf[8 * sizeof(n) + 1];
+	char *str = &buf[sizeof(buf) - 1];
+	*str = '\0';
+	if (base < 2) base = 10;
+	do
+	{
+		int c = (int)(n % base);
+		n /= base;
+		*--str = (char)(c < 10 ? c + '0' : c + 'A' - 10);
+	} while (n);
+	return write(str);
+}
+
+size_t Print::print(double n, int digits)
+{
+	char buf[64];
+	snprintf(buf, sizeof(buf), "%.*f", digits, n);
+	return write(buf);
+}
+
+
+HardwareSerial Serial;
+
+void HardwareSerial::flush()
+{
+	fflush(stdout);
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+	return fputc(c, stdout) == EOF ? 0 : 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+	return fwrite(buffer, 1, size, stdout);
+}
+
+
+static unsigned long long monotonic_us()
+{
+	timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (unsigned long long)t.tv_sec * 1000000ull + (unsigned long long)t.tv_nsec / 1000ull;
+}
+
+static const unsigned long long start_us = monotonic_us();
+
+unsigned long millis()
+{
+	return (unsigned long)((monotonic_us() - start_us) / 1000ull);
+}
+
+unsigned long micros()
+{
+	return (unsigned long)(monotonic_us() - start_us);
+}
+
+void delay(unsigned long ms)
+{
+	timespec t;
+	t.tv_sec = ms / 1000;
+	t.tv_nsec = (long)(ms % 1000) * 1000000L;
+	nanosleep(&t, 0);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+	timespec t;
+	t.tv_sec = us / 1000000u;
+	t.tv_nsec = (long)(us % 1000000u) * 1000L;
+	nanosleep(&t, 0);
+}
@@ -0,0 +1,79 @@
+#ifndef ARD_C_HOST_ARDUINO_H
+#define ARD_C_HOST_ARDUINO_H
+
+// Shim minimal de l'API Arduino permettant de compiler et de mesurer
+// les conteneurs sur un poste de travail (voir CMakeLists.txt).
+// Seul ce dont la librairie a besoin est fourni.
+
+#define ARD_C_HOST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+
+class Print
+{
+public:
+	virtual ~Print() {}
+	virtual size_t write(uint8_t c) = 0;
+	virtual size_t write(const uint8_t *buffer, size_t size);
+
+	size_t write(const char *str) { return str ? write((const uint8_t*)str, strlen(str)) : 0; }
+
+	size_t print(const char *str) { return write(str); }
+	size_t print(char c) { return write((uint8_t)c); }
+	size_t print(unsigned char n, int base = DEC) { return print((unsigned long)n, base); }
+	size_t print(int n, int base = DEC) { return print((long)n, base); }
+	size_t print(unsigned int n, int base = DEC) { return print((unsigned long)n, base); }
+	size_t print(long n, int base = DEC);
+	size_t print(unsigned long n, int base = DEC);
+	size_t print(long long n, int base = DEC);
+	size_t print(unsigned long long n, int base = DEC);
+	size_t print(double n, int digits = 2);
+
+	size_t println() { return write((const uint8_t*)"\r\n", 2); }
+	template<typename T>
+	size_t println(T v) { size_t n = print(v); return n + println(); }
+	template<typename T>
+	size_t println(T v, int f) { size_t n = print(v, f); return n + println(); }
+};
+
+
+class HardwareSerial : public Print
+{
+public:
+	void begin(unsigned long) {}
+	void end() {}
+	void flush();
+	int available() { return 0; }
+	int read() { return -1; }
+	operator bool() const { return true; }
+
+	using Print::write;
+	size_t write(uint8_t c);
+	size_t write(const uint8_t *buffer, size_t size);
+};
+
+extern HardwareSerial Serial;
+
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+#endif	// ARD_C_HOST_ARDUINO_H